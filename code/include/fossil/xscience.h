@@ -26,6 +26,21 @@ extern "C"
 #include "xscience/element.h"
 #include "xscience/physics.h"
 #include "xscience/dataset.h"
+#include "xscience/typedset.h"
+#include "xscience/dataio.h"
+#include "xscience/timeseries.h"
+#include "xscience/random.h"
+#include "xscience/rolling.h"
+#include "xscience/stream.h"
+#include "xscience/groupby.h"
+#include "xscience/sparse.h"
+#include "xscience/matrix.h"
+#include "xscience/sort.h"
+#include "xscience/dataframe.h"
+#include "xscience/pipeline.h"
+#include "xscience/accumulator.h"
+#include "xscience/quantile.h"
+#include "xscience/parallel.h"
 #include "xscience/qubit.h"
 
 #ifdef __cplusplus
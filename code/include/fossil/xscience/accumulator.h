@@ -0,0 +1,114 @@
+/*
+==============================================================================
+Author: Michael Gene Brockus (Dreamer)
+Email: michaelbrockus@gmail.com
+Organization: Fossil Logic
+Description: 
+    This file is part of the Fossil Logic project, where innovation meets
+    excellence in software development. Michael Gene Brockus, also known as
+    "Dreamer," is a dedicated contributor to this project. For any inquiries,
+    feel free to contact Michael at michaelbrockus@gmail.com.
+==============================================================================
+*/
+#ifndef FSCL_ACCUMULATOR_H
+#define FSCL_ACCUMULATOR_H
+
+#ifdef __cplusplus
+extern "C"
+{
+#endif
+
+#include "fossil/xscience/dataset.h"
+#include <stdint.h>
+
+// Size in bytes of a serialized accumulator
+#define FSCL_ACCUM_SERIALIZED_SIZE 64
+
+// Running statistics that can be updated one value at a time and merged
+// exactly with accumulators built on other threads or processes
+typedef struct {
+    uint64_t count;      // number of non-NaN values
+    uint64_t nan_count;  // number of NaN values
+    double sum;
+    double mean;
+    double m2;           // sum of squared deviations from the mean
+    double min;
+    double max;
+} caccumulator;
+
+// =================================================================
+// Avalible functions
+// =================================================================
+
+/**
+ * Initializes an empty accumulator.
+ *
+ * @param accum Pointer to the accumulator.
+ */
+void fscl_accum_init(caccumulator *accum);
+
+/**
+ * Adds one value (Welford update). NaN values are only counted.
+ *
+ * @param accum Pointer to the accumulator.
+ * @param value The value to add.
+ */
+void fscl_accum_update(caccumulator *accum, double value);
+
+/**
+ * Adds every value of a dataset using the single-pass fscl_data_stats.
+ *
+ * @param accum Pointer to the accumulator.
+ * @param dataset Pointer to the dataset.
+ */
+void fscl_accum_update_data(caccumulator *accum, const cdataset *dataset);
+
+/**
+ * Adds the summary statistics of a part of the data, as returned by
+ * fscl_data_stats, as if its values had been added directly.
+ *
+ * @param accum Pointer to the accumulator.
+ * @param stats Pointer to the statistics of the part.
+ */
+void fscl_accum_update_stats(caccumulator *accum, const cdataset_stats *stats);
+
+/**
+ * Merges another accumulator into `accum` (Chan et al. parallel
+ * combination), as if all of its values had been added directly.
+ *
+ * @param accum Pointer to the accumulator receiving the merge.
+ * @param other Pointer to the accumulator being merged.
+ */
+void fscl_accum_merge(caccumulator *accum, const caccumulator *other);
+
+/**
+ * Converts the accumulator to summary statistics.
+ *
+ * @param accum Pointer to the accumulator.
+ * @param stats Pointer to the structure receiving the statistics.
+ */
+void fscl_accum_stats(const caccumulator *accum, cdataset_stats *stats);
+
+/**
+ * Writes the accumulator to a portable little-endian byte layout so that
+ * partial results can be shipped between processes or machines.
+ *
+ * @param accum Pointer to the accumulator.
+ * @param buffer Destination of FSCL_ACCUM_SERIALIZED_SIZE bytes.
+ */
+void fscl_accum_serialize(const caccumulator *accum, unsigned char *buffer);
+
+/**
+ * Reads an accumulator written by fscl_accum_serialize.
+ *
+ * @param accum Pointer to the accumulator to fill.
+ * @param buffer Source of FSCL_ACCUM_SERIALIZED_SIZE bytes.
+ * @return 0 on success, -1 if the buffer is not a serialized accumulator.
+ */
+int fscl_accum_deserialize(caccumulator *accum, const unsigned char *buffer);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif
@@ -0,0 +1,123 @@
+/*
+==============================================================================
+Author: Michael Gene Brockus (Dreamer)
+Email: michaelbrockus@gmail.com
+Organization: Fossil Logic
+Description: 
+    This file is part of the Fossil Logic project, where innovation meets
+    excellence in software development. Michael Gene Brockus, also known as
+    "Dreamer," is a dedicated contributor to this project. For any inquiries,
+    feel free to contact Michael at michaelbrockus@gmail.com.
+==============================================================================
+*/
+#ifndef FSCL_DATAFRAME_H
+#define FSCL_DATAFRAME_H
+
+#ifdef __cplusplus
+extern "C"
+{
+#endif
+
+#include "fossil/xscience/dataset.h"
+
+// Largest number of columns fscl_dataframe_one_hot_encode may append
+#define FSCL_DATAFRAME_MAX_CATEGORIES 4096
+
+// Named column; values.data is 64-byte aligned and owned by the frame
+typedef struct {
+    char *name;
+    cdataset values;
+    void *block;     // raw allocation behind values.data
+} cdataframe_column;
+
+// Columnar table: every column is its own contiguous buffer of `rows` doubles
+typedef struct {
+    cdataframe_column *columns;
+    size_t num_columns;
+    size_t capacity;
+    size_t rows;
+} cdataframe;
+
+// =================================================================
+// Avalible functions
+// =================================================================
+
+/**
+ * Creates an empty data frame whose columns will hold `rows` values.
+ *
+ * @param frame Pointer to the data frame to be created.
+ * @param rows Number of rows of every column.
+ */
+void fscl_dataframe_create(cdataframe *frame, size_t rows);
+
+/**
+ * Erases a data frame and all of its columns.
+ *
+ * @param frame Pointer to the data frame to be erased.
+ */
+void fscl_dataframe_erase(cdataframe *frame);
+
+/**
+ * Appends a zero-filled column. The returned pointer is valid until the
+ * next column is added; the buffer itself lives until the frame is erased
+ * and must not be passed to fscl_data_erase or resized.
+ *
+ * @param frame Pointer to the data frame.
+ * @param name Column name, copied into the frame.
+ * @return The column values, or NULL if the name exists or memory ran out.
+ */
+cdataset *fscl_dataframe_add_column(cdataframe *frame, const char *name);
+
+/**
+ * Looks up a column by name. The pointer is valid until the next column
+ * is added.
+ *
+ * @param frame Pointer to the data frame.
+ * @param name Column name.
+ * @return The column values, or NULL if there is no such column.
+ */
+cdataset *fscl_dataframe_column(const cdataframe *frame, const char *name);
+
+/**
+ * Replaces missing values in one column, or in every column when name is NULL.
+ *
+ * @param frame Pointer to the data frame.
+ * @param name Column name or NULL.
+ * @param replacement_value The value to replace missing values with.
+ */
+void fscl_dataframe_replace_missing(cdataframe *frame, const char *name, double replacement_value);
+
+/**
+ * Standardizes one column, or every column when name is NULL.
+ *
+ * @param frame Pointer to the data frame.
+ * @param name Column name or NULL.
+ */
+void fscl_dataframe_standardize(cdataframe *frame, const char *name);
+
+/**
+ * Normalizes one column to [0, 1], or every column when name is NULL.
+ *
+ * @param frame Pointer to the data frame.
+ * @param name Column name or NULL.
+ */
+void fscl_dataframe_normalize(cdataframe *frame, const char *name);
+
+/**
+ * One-hot encodes a column of non-negative integer categories. One column
+ * named "<name>=<category>" is appended per category from 0 to the
+ * largest value; rows with NaN or negative values get all zeros. Fractional,
+ * infinite or too large (FSCL_DATAFRAME_MAX_CATEGORIES and up) categories
+ * are rejected, and a failure leaves the frame as it was.
+ *
+ * @param frame Pointer to the data frame.
+ * @param name Name of the categorical column.
+ * @return Number of columns appended, or 0 on failure.
+ */
+size_t fscl_dataframe_one_hot_encode(cdataframe *frame, const char *name);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif
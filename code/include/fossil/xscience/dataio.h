@@ -0,0 +1,182 @@
+/*
+==============================================================================
+Author: Michael Gene Brockus (Dreamer)
+Email: michaelbrockus@gmail.com
+Organization: Fossil Logic
+Description: 
+    This file is part of the Fossil Logic project, where innovation meets
+    excellence in software development. Michael Gene Brockus, also known as
+    "Dreamer," is a dedicated contributor to this project. For any inquiries,
+    feel free to contact Michael at michaelbrockus@gmail.com.
+==============================================================================
+*/
+#ifndef FSCL_DATAIO_H
+#define FSCL_DATAIO_H
+
+#ifdef __cplusplus
+extern "C"
+{
+#endif
+
+#include "fossil/xscience/dataset.h"
+
+// How a file is mapped into a dataset
+typedef enum {
+    FSCL_DATA_MAP_READONLY,  // shared read-only pages; mutators must not be used
+    FSCL_DATA_MAP_PRIVATE    // copy-on-write pages; writes never reach the file
+} cdataset_map;
+
+// Optional sections of a binary dataset file, combined with `|`
+#define FSCL_DATA_FILE_CHECKSUMS 1u   // CRC32C of every block, checked by fscl_data_load
+#define FSCL_DATA_FILE_STATS     2u   // cdataset_stats of every block
+
+// Streaming reader over the numeric columns of a delimited text file.
+// Rows are parsed chunk by chunk into one reusable column-major buffer.
+typedef struct {
+    FILE *file;
+    char *buffer;        // raw bytes read from the file
+    size_t capacity;
+    size_t begin;        // first unparsed byte in buffer
+    size_t end;          // one past the last valid byte in buffer
+    double *values;      // chunk_rows x columns, column-major
+    size_t columns;
+    size_t chunk_rows;
+    size_t rows;         // rows held by the current chunk
+    char delimiter;
+    int eof;
+} cdataset_csv;
+
+// Called once per chunk with one dataset view per column; return nonzero to stop
+typedef int (*cdataset_csv_callback)(const cdataset *columns, size_t num_columns, void *context);
+
+// =================================================================
+// Avalible functions
+// =================================================================
+
+/**
+ * Maps a file of raw native-endian doubles straight into a dataset
+ * without copying. The pages are hinted for sequential access, so the
+ * dataset can be larger than physical memory. Trailing bytes that do not
+ * form a whole double are ignored.
+ *
+ * @param dataset Pointer to the dataset to be filled.
+ * @param path Path of the file to map.
+ * @param mode Read-only or copy-on-write mapping.
+ * @return 0 on success, -1 on failure.
+ */
+int fscl_data_open_mmap(cdataset *dataset, const char *path, cdataset_map mode);
+
+/**
+ * Unmaps a dataset opened with fscl_data_open_mmap. fscl_data_erase does
+ * the same for mapped datasets.
+ *
+ * @param dataset Pointer to the mapped dataset.
+ */
+void fscl_data_close_mmap(cdataset *dataset);
+
+/**
+ * Saves a dataset to a versioned binary file: a 64-byte header (type,
+ * count, byte order), the raw doubles aligned at offset 64, then an
+ * optional table with a checksum and statistics for every block of
+ * 65536 elements. The file is written with three sequential writes.
+ *
+ * @param dataset Pointer to the dataset to be saved.
+ * @param path Path of the file to write.
+ * @param flags FSCL_DATA_FILE_CHECKSUMS and/or FSCL_DATA_FILE_STATS, or 0.
+ * @return 0 on success, -1 on failure.
+ */
+int fscl_data_save(const cdataset *dataset, const char *path, unsigned flags);
+
+/**
+ * Loads a binary file with one read into 64-byte aligned memory. Block
+ * checksums, when present, are verified on the thread pool, and files
+ * written with the other byte order are swapped. Release the dataset with
+ * fscl_data_erase, which knows how the memory was allocated.
+ *
+ * @param dataset Pointer to the dataset to be created.
+ * @param path Path of the file to read.
+ * @return 0 on success, -1 on failure or checksum mismatch.
+ */
+int fscl_data_load(cdataset *dataset, const char *path);
+
+/**
+ * Maps the elements of a binary file into a dataset without copying;
+ * close it with fscl_data_close_mmap or fscl_data_erase. Only the header
+ * is checked, so pages are still read on demand.
+ *
+ * @param dataset Pointer to the dataset to be filled.
+ * @param path Path of the file to map.
+ * @param mode Read-only or copy-on-write mapping.
+ * @return 0 on success, -1 on failure or foreign byte order.
+ */
+int fscl_data_load_mmap(cdataset *dataset, const char *path, cdataset_map mode);
+
+/**
+ * Combines the per-block statistics of a binary file without reading
+ * its elements.
+ *
+ * @param path Path of the file.
+ * @param stats Pointer to the structure receiving the statistics.
+ * @return 0 on success, -1 if the file has no statistics table.
+ */
+int fscl_data_file_stats(const char *path, cdataset_stats *stats);
+
+/**
+ * Opens a delimited text file for chunked reading. The number of columns
+ * is taken from the first line, which is skipped when it is a header.
+ *
+ * @param reader Pointer to the reader to initialize.
+ * @param path Path of the file to read.
+ * @param delimiter Field separator, usually ',' or '\t'.
+ * @param has_header Nonzero if the first line holds column names.
+ * @param chunk_rows Rows parsed per chunk.
+ * @return 0 on success, -1 on failure.
+ */
+int fscl_data_csv_open(cdataset_csv *reader, const char *path, char delimiter, int has_header, size_t chunk_rows);
+
+/**
+ * Parses the next chunk of rows. Empty or non-numeric fields, and fields
+ * missing from short rows, become NaN so fscl_data_replace_missing and
+ * fscl_data_remove_missing apply. Blank lines are skipped.
+ *
+ * @param reader Pointer to the reader.
+ * @return Number of rows in the chunk, 0 at end of file.
+ */
+size_t fscl_data_csv_next(cdataset_csv *reader);
+
+/**
+ * Returns a view of one column of the current chunk. The view is valid
+ * until the next call to fscl_data_csv_next and must not be erased.
+ *
+ * @param reader Pointer to the reader.
+ * @param column Index of the column.
+ * @return A dataset view over the column values.
+ */
+cdataset fscl_data_csv_column(const cdataset_csv *reader, size_t column);
+
+/**
+ * Closes the reader and releases its buffers.
+ *
+ * @param reader Pointer to the reader.
+ */
+void fscl_data_csv_close(cdataset_csv *reader);
+
+/**
+ * Streams a delimited text file through a callback, one chunk at a time.
+ *
+ * @param path Path of the file to read.
+ * @param delimiter Field separator.
+ * @param has_header Nonzero if the first line holds column names.
+ * @param chunk_rows Rows parsed per chunk.
+ * @param callback Function receiving the column views of every chunk.
+ * @param context User pointer passed to the callback.
+ * @return 0 when the whole file was read, 1 if the callback stopped early, -1 on failure.
+ */
+int fscl_data_csv_foreach(const char *path, char delimiter, int has_header, size_t chunk_rows,
+                          cdataset_csv_callback callback, void *context);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif
@@ -24,19 +24,55 @@ extern "C"
 #include <stdlib.h>
 #include <stdio.h>
 #include <stddef.h>
+#include "fossil/xscience/parallel.h"
 
 // Define data types
+//
+// A view over caller memory is {buffer, count, NULL}. `ext` belongs to the
+// library (file storage, lookup index, zone map) and must stay NULL unless
+// a library function set it, so initialize with a brace initializer or
+// `= {0}` rather than field by field.
 typedef struct {
     double *data;
     size_t size;
+    void *ext;      // library-owned extras, NULL for plain buffers and views
 } cdataset;
 
+// Instruction set used by the reduction kernels
+typedef enum {
+    FSCL_DATA_SIMD_SCALAR,
+    FSCL_DATA_SIMD_SSE2,
+    FSCL_DATA_SIMD_AVX2,
+    FSCL_DATA_SIMD_AVX512
+} cdataset_simd;
+
+// Execution policy for operations that can run on the thread pool
+typedef enum {
+    FSCL_DATA_EXEC_DEFAULT,   // follow the global policy
+    FSCL_DATA_EXEC_SERIAL,    // always run on the calling thread
+    FSCL_DATA_EXEC_PARALLEL   // run on the thread pool
+} cdataset_exec;
+
+// Summary statistics gathered in a single pass; NaN elements are counted
+// in nan_count and excluded from every other field.
+typedef struct {
+    size_t count;      // number of non-NaN elements
+    size_t nan_count;  // number of NaN elements
+    double sum;
+    double mean;
+    double variance;   // population variance
+    double min;
+    double max;
+} cdataset_stats;
+
 // =================================================================
 // Avalible functions
 // =================================================================
 
 /**
- * Creates a new dataset with the specified size.
+ * Creates a new dataset with the specified size. When the default policy
+ * runs in parallel, large datasets are zero-filled by the thread pool so
+ * every page is first touched by the thread that will process it.
  *
  * @param dataset Pointer to the dataset to be created.
  * @param size Size of the dataset.
@@ -44,7 +80,8 @@ typedef struct {
 void fscl_data_create(cdataset *dataset, size_t size);
 
 /**
- * Erases memory allocated for a dataset.
+ * Erases memory allocated for a dataset, unmapping it if it was opened
+ * with fscl_data_open_mmap.
  *
  * @param dataset Pointer to the dataset to be erased.
  */
@@ -58,7 +95,9 @@ void fscl_data_erase(cdataset *dataset);
 void fscl_data_print(const cdataset *dataset);
 
 /**
- * Fills the dataset with random values.
+ * Fills the dataset with uniform random values in [0, 100). Each call
+ * uses the next seed of the sequence set by fscl_data_seed_random; see
+ * random.h for explicit seeds and other distributions.
  *
  * @param dataset Pointer to the dataset to be filled with random values.
  */
@@ -73,10 +112,47 @@ void fscl_data_fill_random(cdataset *dataset);
 double fscl_data_mean(const cdataset *dataset);
 
 /**
- * Calculates the standard deviation of the dataset.
+ * Computes count, sum, mean, variance, min, max and NaN count in one
+ * streaming pass over the dataset. Large datasets are split into chunks
+ * whose partial results are merged in order, on the thread pool when the
+ * default policy is parallel. When no element is a number, mean,
+ * variance, min and max are NaN.
  *
  * @param dataset Pointer to the dataset.
- * @return The standard deviation.
+ * @param stats Pointer to the structure receiving the statistics.
+ */
+void fscl_data_stats(const cdataset *dataset, cdataset_stats *stats);
+
+/**
+ * Merges the statistics of another part of the data into `stats`, as if
+ * both parts had been scanned together, using the same combination as
+ * fscl_accum_merge. A zero-initialized structure is a valid empty starting
+ * point; when both parts are empty the mean, variance, min and max are NaN.
+ *
+ * @param stats Pointer to the running statistics.
+ * @param other Pointer to the statistics of the other part.
+ */
+void fscl_data_stats_merge(cdataset_stats *stats, const cdataset_stats *other);
+
+/**
+ * Computes the statistics of many short series stored back to back, as
+ * fscl_data_stats would for each one. Series of similar length are run
+ * side by side, one per lane, and groups of series are spread over the
+ * thread pool.
+ *
+ * @param values Elements of every series, one series after another.
+ * @param offsets num_series + 1 ascending positions; series i holds
+ *                values[offsets[i]] up to values[offsets[i + 1]].
+ * @param num_series Number of series.
+ * @param stats Receives the statistics of every series.
+ */
+void fscl_data_stats_batch(const double *values, const size_t *offsets, size_t num_series, cdataset_stats *stats);
+
+/**
+ * Calculates the (population) standard deviation of the dataset.
+ *
+ * @param dataset Pointer to the dataset.
+ * @return The standard deviation, or NaN if the dataset contains NaN.
  */
 double fscl_data_std_dev(const cdataset *dataset);
 
@@ -88,6 +164,15 @@ double fscl_data_std_dev(const cdataset *dataset);
  */
 void fscl_data_scale(cdataset *dataset, double factor);
 
+/**
+ * Scales the dataset using the given execution policy.
+ *
+ * @param dataset Pointer to the dataset to be scaled.
+ * @param factor Scaling factor.
+ * @param policy Execution policy for this call.
+ */
+void fscl_data_scale_ex(cdataset *dataset, double factor, cdataset_exec policy);
+
 /**
  * Performs element-wise addition of two datasets and stores the result in a third dataset.
  *
@@ -97,11 +182,21 @@ void fscl_data_scale(cdataset *dataset, double factor);
  */
 void fscl_data_add(const cdataset *dataset1, const cdataset *dataset2, cdataset *result);
 
+/**
+ * Performs element-wise addition using the given execution policy.
+ *
+ * @param dataset1 Pointer to the first dataset.
+ * @param dataset2 Pointer to the second dataset.
+ * @param result Pointer to the dataset where the result will be stored.
+ * @param policy Execution policy for this call.
+ */
+void fscl_data_add_ex(const cdataset *dataset1, const cdataset *dataset2, cdataset *result, cdataset_exec policy);
+
 /**
  * Finds the minimum value in the dataset.
  *
  * @param dataset Pointer to the dataset.
- * @return The minimum value.
+ * @return The minimum value, or NaN if the dataset is empty.
  */
 double fscl_data_min(const cdataset *dataset);
 
@@ -109,7 +204,7 @@ double fscl_data_min(const cdataset *dataset);
  * Finds the maximum value in the dataset.
  *
  * @param dataset Pointer to the dataset.
- * @return The maximum value.
+ * @return The maximum value, or NaN if the dataset is empty.
  */
 double fscl_data_max(const cdataset *dataset);
 
@@ -138,6 +233,89 @@ double fscl_data_product(const cdataset *dataset);
  */
 int fscl_data_find(const cdataset *dataset, double value);
 
+/**
+ * Hands the buffer behind `data` to another owner, such as a file mapping.
+ * fscl_data_erase then calls release(storage) instead of free(data), and
+ * functions that would reallocate the buffer refuse.
+ *
+ * @param dataset Pointer to the dataset.
+ * @param storage The owner of the buffer.
+ * @param release Function that frees the buffer and its owner.
+ * @return 0 on success, -1 if memory could not be allocated.
+ */
+int fscl_data_storage_attach(cdataset *dataset, void *storage, void (*release)(void *storage));
+
+/**
+ * Gets the owner set by fscl_data_storage_attach.
+ *
+ * @param dataset Pointer to the dataset.
+ * @return The owner, or NULL if the buffer comes from malloc or the caller.
+ */
+void *fscl_data_storage_get(const cdataset *dataset);
+
+/**
+ * Builds a lookup index so that fscl_data_find runs in O(1) and
+ * fscl_data_find_range in O(log n). The mutating functions of this
+ * library drop the index; code writing to `data` directly must call
+ * fscl_data_index_drop itself.
+ *
+ * @param dataset Pointer to the dataset.
+ * @return 0 on success, -1 if memory could not be allocated.
+ */
+int fscl_data_index_build(cdataset *dataset);
+
+/**
+ * Frees the lookup index of a dataset, if any.
+ *
+ * @param dataset Pointer to the dataset.
+ */
+void fscl_data_index_drop(cdataset *dataset);
+
+/**
+ * Builds a zone map: the minimum and maximum of every block of 4096
+ * elements. fscl_data_find and fscl_data_find_range then skip blocks that
+ * cannot match, and fscl_data_min/max read only the block summaries. The
+ * mutating functions of this library keep the zone map current; code
+ * writing to `data` directly must call fscl_data_zones_update itself.
+ *
+ * @param dataset Pointer to the dataset.
+ * @return 0 on success, -1 if memory could not be allocated.
+ */
+int fscl_data_zones_build(cdataset *dataset);
+
+/**
+ * Recomputes the zones covering the elements in [begin, end), or every
+ * zone if the buffer was resized or replaced. Does nothing when the
+ * dataset has no zone map.
+ *
+ * @param dataset Pointer to the dataset.
+ * @param begin Index of the first changed element.
+ * @param end Index past the last changed element.
+ * @return 0 on success, -1 if memory could not be allocated (the zone
+ *         map is then dropped).
+ */
+int fscl_data_zones_update(cdataset *dataset, size_t begin, size_t end);
+
+/**
+ * Frees the zone map of a dataset, if any.
+ *
+ * @param dataset Pointer to the dataset.
+ */
+void fscl_data_zones_drop(cdataset *dataset);
+
+/**
+ * Finds the elements whose value lies in [low, high].
+ *
+ * @param dataset Pointer to the dataset.
+ * @param low Lower bound, inclusive.
+ * @param high Upper bound, inclusive.
+ * @param positions Receives up to `capacity` indices of matching elements,
+ *                  by ascending value when indexed and by position otherwise.
+ * @param capacity Size of the positions array.
+ * @return The total number of matching elements.
+ */
+size_t fscl_data_find_range(const cdataset *dataset, double low, double high, size_t *positions, size_t capacity);
+
 /**
  * Performs element-wise multiplication of two datasets and stores the result in a third dataset.
  *
@@ -147,6 +325,16 @@ int fscl_data_find(const cdataset *dataset, double value);
  */
 void fscl_data_multiply(const cdataset *dataset1, const cdataset *dataset2, cdataset *result);
 
+/**
+ * Performs element-wise multiplication using the given execution policy.
+ *
+ * @param dataset1 Pointer to the first dataset.
+ * @param dataset2 Pointer to the second dataset.
+ * @param result Pointer to the dataset where the result will be stored.
+ * @param policy Execution policy for this call.
+ */
+void fscl_data_multiply_ex(const cdataset *dataset1, const cdataset *dataset2, cdataset *result, cdataset_exec policy);
+
 /**
  * Normalizes the dataset between 0 and 1.
  *
@@ -163,6 +351,16 @@ void fscl_data_normalize(cdataset *dataset);
  */
 void fscl_data_subtract(const cdataset *dataset1, const cdataset *dataset2, cdataset *result);
 
+/**
+ * Performs element-wise subtraction using the given execution policy.
+ *
+ * @param dataset1 Pointer to the first dataset.
+ * @param dataset2 Pointer to the second dataset.
+ * @param result Pointer to the dataset where the result will be stored.
+ * @param policy Execution policy for this call.
+ */
+void fscl_data_subtract_ex(const cdataset *dataset1, const cdataset *dataset2, cdataset *result, cdataset_exec policy);
+
 /**
  * Calculates the dot product of two datasets.
  *
@@ -188,7 +386,8 @@ void fscl_data_remove_missing(cdataset *dataset);
 void fscl_data_replace_missing(cdataset *dataset, double replacement_value);
 
 /**
- * Removes outliers from the dataset using a z-score threshold.
+ * Removes outliers from the dataset using a z-score threshold. Missing
+ * values are removed as well and do not affect the mean or deviation.
  *
  * @param dataset Pointer to the dataset.
  * @param z_threshold The z-score threshold for detecting outliers.
@@ -197,26 +396,97 @@ void fscl_data_remove_outliers(cdataset *dataset, double z_threshold);
 
 /**
  * Standardizes the dataset (subtract mean, divide by standard deviation).
+ * NaN elements are ignored by the statistics and stay NaN; a constant
+ * dataset is left unchanged.
  *
  * @param dataset Pointer to the dataset to be standardized.
  */
 void fscl_data_standardize(cdataset *dataset);
 
 /**
- * Normalizes numeric features in the dataset.
+ * Normalizes numeric features in the dataset to [0, 1]. The range is
+ * computed once, then applied in a single pass that runs on the thread
+ * pool for large datasets. A constant dataset becomes all zeros and NaN
+ * elements are left untouched.
  *
  * @param dataset Pointer to the dataset.
  */
 void fscl_data_normalize_features(cdataset *dataset);
 
 /**
- * Encodes categorical variables using one-hot encoding.
+ * Normalizes every column of a row-major feature matrix to [0, 1] using
+ * the column's own range. Trailing elements that do not fill a row are
+ * left untouched.
+ *
+ * @param dataset Pointer to the dataset holding the matrix.
+ * @param num_features Number of columns per row.
+ */
+void fscl_data_normalize_columns(cdataset *dataset, size_t num_features);
+
+/**
+ * Encodes categorical variables using one-hot encoding. Mapped datasets
+ * cannot grow and are left unchanged. The dense output grows with the
+ * number of categories; fscl_data_one_hot_sparse stores one entry per row.
  *
  * @param dataset Pointer to the dataset containing categorical variables.
  * @param feature_index Index of the feature to be one-hot encoded.
  */
 void fscl_data_one_hot_encode(cdataset *dataset, size_t feature_index);
 
+/**
+ * Sets the global execution policy used by calls that pass
+ * FSCL_DATA_EXEC_DEFAULT (and by the functions without an _ex variant).
+ * With the global policy left at FSCL_DATA_EXEC_DEFAULT, operations run
+ * in parallel whenever the thread pool has more than one thread. Choosing
+ * FSCL_DATA_EXEC_PARALLEL here or per call sizes a still single-threaded
+ * pool to one thread per CPU. Parallel and serial runs give bitwise
+ * identical results.
+ *
+ * @param policy The new global policy.
+ */
+void fscl_data_set_exec(cdataset_exec policy);
+
+/**
+ * Gets the global execution policy.
+ *
+ * @return The global policy.
+ */
+cdataset_exec fscl_data_get_exec(void);
+
+/**
+ * Reports whether a call made under `policy` runs on the thread pool;
+ * FSCL_DATA_EXEC_DEFAULT follows the global policy. FSCL_DATA_EXEC_PARALLEL
+ * sizes a still single-threaded pool to one thread per CPU first.
+ *
+ * @param policy The policy of the call.
+ * @return Nonzero if the call should use the pool.
+ */
+int fscl_data_parallel(cdataset_exec policy);
+
+/**
+ * Runs a task over [0, count) in chunks of `grain` elements under an
+ * execution policy: on the pool when fscl_data_parallel(policy) says so,
+ * otherwise chunk by chunk on the calling thread. The chunks are the same
+ * either way, so per-chunk results never depend on the policy. Every
+ * loop of the library that uses the pool goes through here, and every
+ * chunked loop decides through fscl_data_parallel.
+ *
+ * @param policy The policy of the call.
+ * @param count Number of elements.
+ * @param grain Elements per chunk (zero is treated as one).
+ * @param task Callback invoked for every chunk.
+ * @param context User pointer passed to the callback.
+ */
+void fscl_data_for(cdataset_exec policy, size_t count, size_t grain, cparallel_task task, void *context);
+
+/**
+ * Reports the instruction set selected at load time for the sum, mean,
+ * min, max, dot product and compaction kernels.
+ *
+ * @return The active SIMD level.
+ */
+cdataset_simd fscl_data_simd_level(void);
+
 #ifdef __cplusplus
 }
 #endif
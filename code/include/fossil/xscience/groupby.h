@@ -0,0 +1,63 @@
+/*
+==============================================================================
+Author: Michael Gene Brockus (Dreamer)
+Email: michaelbrockus@gmail.com
+Organization: Fossil Logic
+Description: 
+    This file is part of the Fossil Logic project, where innovation meets
+    excellence in software development. Michael Gene Brockus, also known as
+    "Dreamer," is a dedicated contributor to this project. For any inquiries,
+    feel free to contact Michael at michaelbrockus@gmail.com.
+==============================================================================
+*/
+#ifndef FSCL_GROUPBY_H
+#define FSCL_GROUPBY_H
+
+#ifdef __cplusplus
+extern "C"
+{
+#endif
+
+#include "fossil/xscience/dataset.h"
+
+// Per-key aggregates; entry i of every dataset belongs to keys.data[i]
+typedef struct {
+    cdataset keys;       // distinct keys in ascending order
+    cdataset counts;     // rows per key
+    cdataset *sums;      // per value dataset: sum of the non-NaN values
+    cdataset *means;     // per value dataset: mean of the non-NaN values
+    size_t num_values;
+} cgroupby;
+
+// =================================================================
+// Avalible functions
+// =================================================================
+
+/**
+ * Aggregates value datasets per distinct key. Rows whose key is NaN are
+ * skipped; NaN values are left out of the sums and means but still count
+ * as rows. Few distinct keys are aggregated into one hash table per chunk
+ * and merged in chunk order; many distinct keys are first partitioned by
+ * hash so each partition fits its own table. Either way chunks and
+ * partitions are fixed, so the result does not depend on the thread count.
+ *
+ * @param keys Pointer to the key dataset; every non-NaN value must be an integer.
+ * @param values Array of value datasets, each as long as the keys.
+ * @param num_values Number of value datasets (may be zero).
+ * @param result Pointer to the aggregates to be created.
+ * @return 0 on success, -1 on mismatched sizes, a non-integer key or failed allocation.
+ */
+int fscl_data_group_by(const cdataset *keys, const cdataset *values, size_t num_values, cgroupby *result);
+
+/**
+ * Erases the datasets of a group-by result.
+ *
+ * @param result Pointer to the aggregates.
+ */
+void fscl_group_by_erase(cgroupby *result);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif
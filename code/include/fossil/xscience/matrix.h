@@ -0,0 +1,145 @@
+/*
+==============================================================================
+Author: Michael Gene Brockus (Dreamer)
+Email: michaelbrockus@gmail.com
+Organization: Fossil Logic
+Description: 
+    This file is part of the Fossil Logic project, where innovation meets
+    excellence in software development. Michael Gene Brockus, also known as
+    "Dreamer," is a dedicated contributor to this project. For any inquiries,
+    feel free to contact Michael at michaelbrockus@gmail.com.
+==============================================================================
+*/
+#ifndef FSCL_MATRIX_H
+#define FSCL_MATRIX_H
+
+#ifdef __cplusplus
+extern "C"
+{
+#endif
+
+#include "fossil/xscience/dataset.h"
+
+// Element order of a matrix view
+typedef enum {
+    FSCL_MATRIX_ROW_MAJOR,   // rows are contiguous
+    FSCL_MATRIX_COL_MAJOR    // columns are contiguous
+} cmatrix_layout;
+
+// Matrix view over a dataset buffer; it never owns the memory
+typedef struct {
+    double *data;
+    size_t rows;
+    size_t cols;
+    size_t stride;           // elements between consecutive rows (row-major) or columns (column-major)
+    cmatrix_layout layout;
+} cmatrix;
+
+// =================================================================
+// Avalible functions
+// =================================================================
+
+/**
+ * Views the start of a dataset as a matrix.
+ *
+ * @param matrix Pointer to the view.
+ * @param dataset Pointer to the dataset holding the elements.
+ * @param rows Number of rows.
+ * @param cols Number of columns.
+ * @param layout Element order.
+ * @return 0 on success, -1 if the dataset holds fewer than rows * cols elements.
+ */
+int fscl_matrix_view(cmatrix *matrix, const cdataset *dataset, size_t rows, size_t cols, cmatrix_layout layout);
+
+/**
+ * Views a rectangular block of a matrix.
+ *
+ * @param block Pointer to the view of the block.
+ * @param matrix Pointer to the matrix.
+ * @param row First row of the block.
+ * @param col First column of the block.
+ * @param rows Number of rows of the block.
+ * @param cols Number of columns of the block.
+ * @return 0 on success, -1 if the block does not fit in the matrix.
+ */
+int fscl_matrix_block(cmatrix *block, const cmatrix *matrix, size_t row, size_t col, size_t rows, size_t cols);
+
+/**
+ * Turns a view into the view of its transpose without moving elements.
+ *
+ * @param matrix Pointer to the view.
+ */
+void fscl_matrix_transpose(cmatrix *matrix);
+
+/**
+ * Gets one element.
+ *
+ * @param matrix Pointer to the matrix.
+ * @param row Row of the element.
+ * @param col Column of the element.
+ * @return The element.
+ */
+double fscl_matrix_get(const cmatrix *matrix, size_t row, size_t col);
+
+/**
+ * Computes y = alpha * A * x + beta * y. Rows are blocked so x stays in
+ * cache and are split over the thread pool; every element of y is summed
+ * in the same order whatever the thread count. With beta zero, y is
+ * overwritten without being read.
+ *
+ * @param alpha Scale of the product.
+ * @param a Pointer to the matrix.
+ * @param x Pointer to the vector, with one element per column.
+ * @param beta Scale of the previous y.
+ * @param y Pointer to the result, with one element per row; must not overlap A or x.
+ * @return 0 on success, -1 on mismatched sizes.
+ */
+int fscl_matrix_gemv(double alpha, const cmatrix *a, const cdataset *x, double beta, cdataset *y);
+
+/**
+ * Computes C = alpha * A * B + beta * C. Operands are packed into
+ * cache-sized panels and multiplied by a register-tiled microkernel
+ * (AVX2/FMA when available); blocks of rows of C are split over the
+ * thread pool. Any layout mix is accepted. With beta zero, C is
+ * overwritten without being read.
+ *
+ * @param alpha Scale of the product.
+ * @param a Pointer to the left matrix.
+ * @param b Pointer to the right matrix.
+ * @param beta Scale of the previous C.
+ * @param c Pointer to the result; must not overlap A or B.
+ * @return 0 on success, -1 on mismatched sizes or failed allocation.
+ */
+int fscl_matrix_gemm(double alpha, const cmatrix *a, const cmatrix *b, double beta, cmatrix *c);
+
+/**
+ * Computes the population covariance of every pair of columns as a
+ * row-major num_columns x num_columns dataset. The columns are centered
+ * once into one buffer, then the upper triangle of its Gram matrix is
+ * built block by block with the GEMM kernel, blocks spread over the
+ * thread pool, and mirrored. A column holding NaN gives NaN in its row
+ * and column.
+ *
+ * @param columns Array of datasets of equal size, one per column.
+ * @param num_columns Number of columns.
+ * @param result Pointer to the dataset to be created.
+ * @return 0 on success, -1 on empty or mismatched columns or failed allocation.
+ */
+int fscl_data_covariance_matrix(const cdataset *columns, size_t num_columns, cdataset *result);
+
+/**
+ * Computes the Pearson correlation of every pair of columns from the
+ * covariance matrix. Pairs involving a constant column are NaN.
+ *
+ * @param columns Array of datasets of equal size, one per column.
+ * @param num_columns Number of columns.
+ * @param result Pointer to the dataset to be created.
+ * @return 0 on success, -1 on empty or mismatched columns or failed allocation.
+ */
+int fscl_data_correlation_matrix(const cdataset *columns, size_t num_columns, cdataset *result);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif
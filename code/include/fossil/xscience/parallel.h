@@ -0,0 +1,77 @@
+/*
+==============================================================================
+Author: Michael Gene Brockus (Dreamer)
+Email: michaelbrockus@gmail.com
+Organization: Fossil Logic
+Description: 
+    This file is part of the Fossil Logic project, where innovation meets
+    excellence in software development. Michael Gene Brockus, also known as
+    "Dreamer," is a dedicated contributor to this project. For any inquiries,
+    feel free to contact Michael at michaelbrockus@gmail.com.
+==============================================================================
+*/
+#ifndef FSCL_PARALLEL_H
+#define FSCL_PARALLEL_H
+
+#ifdef __cplusplus
+extern "C"
+{
+#endif
+
+#include <stddef.h>
+
+// Work callback for a parallel loop; processes elements [begin, end)
+typedef void (*cparallel_task)(void *context, size_t begin, size_t end);
+
+// =================================================================
+// Avalible functions
+// =================================================================
+
+/**
+ * Sets the number of threads used by parallel loops. The default of one
+ * thread runs every loop on the calling thread; passing zero uses one
+ * thread per online CPU. Worker threads are started lazily and persist
+ * until the count changes or the pool is shut down.
+ *
+ * @param threads Number of threads including the calling thread.
+ */
+void fscl_parallel_set_threads(size_t threads);
+
+/**
+ * Gets the number of threads used by parallel loops.
+ *
+ * @return The configured thread count.
+ */
+size_t fscl_parallel_get_threads(void);
+
+/**
+ * Gets the number of online CPUs.
+ *
+ * @return The CPU count, at least one.
+ */
+size_t fscl_parallel_cpu_count(void);
+
+/**
+ * Runs a task over [0, count) split into chunks of `grain` elements.
+ * The task is called once per chunk, so `begin / grain` is a stable chunk
+ * index usable for per-chunk partial results. Each thread receives the
+ * same contiguous run of chunks for a given count, grain and thread
+ * count. Calls made while another loop is running execute serially.
+ *
+ * @param count Number of elements.
+ * @param grain Elements per chunk (zero is treated as one).
+ * @param task Callback invoked for every chunk.
+ * @param context User pointer passed to the callback.
+ */
+void fscl_parallel_for(size_t count, size_t grain, cparallel_task task, void *context);
+
+/**
+ * Stops and joins the worker threads. The pool restarts on next use.
+ */
+void fscl_parallel_shutdown(void);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif
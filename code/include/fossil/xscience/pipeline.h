@@ -0,0 +1,116 @@
+/*
+==============================================================================
+Author: Michael Gene Brockus (Dreamer)
+Email: michaelbrockus@gmail.com
+Organization: Fossil Logic
+Description: 
+    This file is part of the Fossil Logic project, where innovation meets
+    excellence in software development. Michael Gene Brockus, also known as
+    "Dreamer," is a dedicated contributor to this project. For any inquiries,
+    feel free to contact Michael at michaelbrockus@gmail.com.
+==============================================================================
+*/
+#ifndef FSCL_PIPELINE_H
+#define FSCL_PIPELINE_H
+
+#ifdef __cplusplus
+extern "C"
+{
+#endif
+
+#include "fossil/xscience/dataset.h"
+
+// Deferred dataset transforms
+typedef enum {
+    FSCL_PIPELINE_REPLACE_MISSING,  // NaN -> value
+    FSCL_PIPELINE_SCALE,            // x * value
+    FSCL_PIPELINE_OFFSET,           // x + value
+    FSCL_PIPELINE_STANDARDIZE,      // (x - mean) / std_dev
+    FSCL_PIPELINE_NORMALIZE         // (x - min) / (max - min)
+} cpipeline_op;
+
+typedef struct {
+    cpipeline_op op;
+    double value;
+} cpipeline_stage;
+
+// Ordered list of stages, evaluated only by fscl_pipeline_run
+typedef struct {
+    cpipeline_stage *stages;
+    size_t count;
+    size_t capacity;
+} cpipeline;
+
+// =================================================================
+// Avalible functions
+// =================================================================
+
+/**
+ * Creates an empty pipeline.
+ *
+ * @param pipeline Pointer to the pipeline to be created.
+ */
+void fscl_pipeline_create(cpipeline *pipeline);
+
+/**
+ * Erases the stages of a pipeline.
+ *
+ * @param pipeline Pointer to the pipeline to be erased.
+ */
+void fscl_pipeline_erase(cpipeline *pipeline);
+
+/**
+ * Appends a stage replacing missing values, like fscl_data_replace_missing.
+ *
+ * @param pipeline Pointer to the pipeline.
+ * @param replacement_value The value to replace missing values with.
+ */
+void fscl_pipeline_replace_missing(cpipeline *pipeline, double replacement_value);
+
+/**
+ * Appends a stage scaling every value, like fscl_data_scale.
+ *
+ * @param pipeline Pointer to the pipeline.
+ * @param factor Scaling factor.
+ */
+void fscl_pipeline_scale(cpipeline *pipeline, double factor);
+
+/**
+ * Appends a stage adding a constant to every value.
+ *
+ * @param pipeline Pointer to the pipeline.
+ * @param offset Value to add.
+ */
+void fscl_pipeline_offset(cpipeline *pipeline, double offset);
+
+/**
+ * Appends a stage standardizing the values, like fscl_data_standardize.
+ *
+ * @param pipeline Pointer to the pipeline.
+ */
+void fscl_pipeline_standardize(cpipeline *pipeline);
+
+/**
+ * Appends a stage normalizing the values to [0, 1], like fscl_data_normalize.
+ *
+ * @param pipeline Pointer to the pipeline.
+ */
+void fscl_pipeline_normalize(cpipeline *pipeline);
+
+/**
+ * Evaluates the pipeline in place. All stages collapse into a single
+ * per-element map `isnan(x) ? c : a * x + b`. Statistics needed by
+ * standardize/normalize stages are derived from one statistics pass over
+ * the input, so any pipeline costs at most two sweeps over memory.
+ *
+ * @param pipeline Pointer to the pipeline.
+ * @param dataset Pointer to the dataset to transform.
+ * @return Number of sweeps made over the dataset.
+ */
+size_t fscl_pipeline_run(const cpipeline *pipeline, cdataset *dataset);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif
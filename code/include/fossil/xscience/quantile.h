@@ -0,0 +1,139 @@
+/*
+==============================================================================
+Author: Michael Gene Brockus (Dreamer)
+Email: michaelbrockus@gmail.com
+Organization: Fossil Logic
+Description: 
+    This file is part of the Fossil Logic project, where innovation meets
+    excellence in software development. Michael Gene Brockus, also known as
+    "Dreamer," is a dedicated contributor to this project. For any inquiries,
+    feel free to contact Michael at michaelbrockus@gmail.com.
+==============================================================================
+*/
+#ifndef FSCL_QUANTILE_H
+#define FSCL_QUANTILE_H
+
+#ifdef __cplusplus
+extern "C"
+{
+#endif
+
+#include "fossil/xscience/dataset.h"
+#include <stdint.h>
+
+#define FSCL_SKETCH_MAX_LEVELS 64
+
+// Datasets with at most this many elements get exact quantiles from a
+// copy; larger ones are summarized by sketches in bounded memory
+#define FSCL_QUANTILE_EXACT_LIMIT ((size_t)1 << 20)
+
+// KLL quantile sketch: a stack of compactors where an item on level h
+// stands for 2^h input values. Memory stays O(k log(n / k)) and the rank
+// error is roughly 2/k with high probability.
+typedef struct {
+    double *items[FSCL_SKETCH_MAX_LEVELS];
+    size_t sizes[FSCL_SKETCH_MAX_LEVELS];
+    size_t allocated[FSCL_SKETCH_MAX_LEVELS];
+    size_t capacities[FSCL_SKETCH_MAX_LEVELS];  // recomputed when levels changes
+    size_t capacity;                            // sum of the level capacities
+    size_t levels;
+    size_t k;
+    uint64_t count;     // number of non-NaN values seen
+    uint64_t random;    // state of the compaction coin flips
+    double min;
+    double max;
+} cquantile_sketch;
+
+// =================================================================
+// Avalible functions
+// =================================================================
+
+/**
+ * Creates an empty sketch. Larger k gives smaller error and more memory.
+ *
+ * @param sketch Pointer to the sketch to be created.
+ * @param k Accuracy parameter, at least 8 (200 gives about 1% rank error).
+ */
+void fscl_sketch_create(cquantile_sketch *sketch, size_t k);
+
+/**
+ * Erases the memory held by a sketch.
+ *
+ * @param sketch Pointer to the sketch to be erased.
+ */
+void fscl_sketch_erase(cquantile_sketch *sketch);
+
+/**
+ * Adds a value to the sketch; NaN values are ignored.
+ *
+ * @param sketch Pointer to the sketch.
+ * @param value The value to add.
+ */
+void fscl_sketch_update(cquantile_sketch *sketch, double value);
+
+/**
+ * Adds every value of a dataset to the sketch.
+ *
+ * @param sketch Pointer to the sketch.
+ * @param dataset Pointer to the dataset.
+ */
+void fscl_sketch_update_data(cquantile_sketch *sketch, const cdataset *dataset);
+
+/**
+ * Merges another sketch, built with the same k, into `sketch`.
+ *
+ * @param sketch Pointer to the sketch receiving the merge.
+ * @param other Pointer to the sketch being merged.
+ */
+void fscl_sketch_merge(cquantile_sketch *sketch, const cquantile_sketch *other);
+
+/**
+ * Estimates the q-quantile of the values seen so far.
+ *
+ * @param sketch Pointer to the sketch.
+ * @param q Quantile in [0, 1]; 0 and 1 return the exact min and max.
+ * @return The estimate, or NaN if the sketch is empty.
+ */
+double fscl_sketch_quantile(const cquantile_sketch *sketch, double q);
+
+/**
+ * Computes q-quantiles of a dataset, ignoring NaN. Datasets of at most
+ * FSCL_QUANTILE_EXACT_LIMIT elements are copied once for all requested
+ * quantiles and answered exactly, interpolating linearly between order
+ * statistics: one quantile with introselect, several with a radix sort of
+ * the copy. Larger datasets, and smaller ones whose copy cannot be
+ * allocated, are estimated from per-chunk sketches merged in chunk order
+ * across the thread pool; the estimates are retained values (rank error
+ * about 1%) and do not depend on the thread count.
+ *
+ * @param dataset Pointer to the dataset.
+ * @param q Quantiles in [0, 1].
+ * @param count Number of quantiles.
+ * @param results Receives one value per quantile (NaN if the dataset holds no numbers).
+ * @return 0 on success, -1 if memory could not be allocated.
+ */
+int fscl_data_quantiles(const cdataset *dataset, const double *q, size_t count, double *results);
+
+/**
+ * Computes the q-quantile of a dataset, ignoring NaN; see fscl_data_quantiles.
+ *
+ * @param dataset Pointer to the dataset.
+ * @param q Quantile in [0, 1].
+ * @return The quantile, or NaN if the dataset holds no numbers.
+ */
+double fscl_data_quantile(const cdataset *dataset, double q);
+
+/**
+ * Computes the median of a dataset, ignoring NaN; exact up to
+ * FSCL_QUANTILE_EXACT_LIMIT elements, see fscl_data_quantiles.
+ *
+ * @param dataset Pointer to the dataset.
+ * @return The median, or NaN if the dataset holds no numbers.
+ */
+double fscl_data_median(const cdataset *dataset);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif
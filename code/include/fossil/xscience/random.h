@@ -0,0 +1,140 @@
+/*
+==============================================================================
+Author: Michael Gene Brockus (Dreamer)
+Email: michaelbrockus@gmail.com
+Organization: Fossil Logic
+Description: 
+    This file is part of the Fossil Logic project, where innovation meets
+    excellence in software development. Michael Gene Brockus, also known as
+    "Dreamer," is a dedicated contributor to this project. For any inquiries,
+    feel free to contact Michael at michaelbrockus@gmail.com.
+==============================================================================
+*/
+#ifndef FSCL_RANDOM_H
+#define FSCL_RANDOM_H
+
+#ifdef __cplusplus
+extern "C"
+{
+#endif
+
+#include "fossil/xscience/dataset.h"
+#include <stdint.h>
+
+// xoshiro256** generator; every stream owns its state, so no locking
+typedef struct {
+    uint64_t s[4];
+} crandom;
+
+// Distributions produced by the bulk generators
+typedef enum {
+    FSCL_RANDOM_UNIFORM,      // uniform in [a, b)
+    FSCL_RANDOM_NORMAL,       // mean a, standard deviation b
+    FSCL_RANDOM_EXPONENTIAL   // rate a
+} crandom_dist;
+
+// =================================================================
+// Avalible functions
+// =================================================================
+
+/**
+ * Seeds a stream. The seed is expanded with splitmix64, so nearby seeds
+ * give unrelated streams.
+ *
+ * @param rng Pointer to the stream.
+ * @param seed The seed.
+ */
+void fscl_random_seed(crandom *rng, uint64_t seed);
+
+/**
+ * Advances the stream by 2^128 draws. Calling it k times after seeding
+ * gives the k-th of 2^128 non-overlapping streams.
+ *
+ * @param rng Pointer to the stream.
+ */
+void fscl_random_jump(crandom *rng);
+
+/**
+ * Advances the stream by 2^192 draws, for splitting a stream into
+ * independent groups of jump streams.
+ *
+ * @param rng Pointer to the stream.
+ */
+void fscl_random_long_jump(crandom *rng);
+
+/**
+ * Draws 64 random bits.
+ *
+ * @param rng Pointer to the stream.
+ * @return The next value of the stream.
+ */
+uint64_t fscl_random_next(crandom *rng);
+
+/**
+ * Draws a uniform value in [0, 1) with 52 random bits.
+ *
+ * @param rng Pointer to the stream.
+ * @return The value.
+ */
+double fscl_random_uniform(crandom *rng);
+
+/**
+ * Draws a normal value (Box-Muller, two draws per value).
+ *
+ * @param rng Pointer to the stream.
+ * @param mean Mean of the distribution.
+ * @param std_dev Standard deviation of the distribution.
+ * @return The value.
+ */
+double fscl_random_normal(crandom *rng, double mean, double std_dev);
+
+/**
+ * Draws an exponential value.
+ *
+ * @param rng Pointer to the stream.
+ * @param rate Rate of the distribution.
+ * @return The value.
+ */
+double fscl_random_exponential(crandom *rng, double rate);
+
+/**
+ * Fills an array from a distribution. Four lanes, the stream and its next
+ * three jump streams, advance in lockstep (with AVX2 when available), so
+ * the output is the same on every CPU; afterwards `rng` continues after
+ * the draws of its own lane.
+ *
+ * @param rng Pointer to the stream.
+ * @param values Receives `count` values.
+ * @param count Number of values.
+ * @param dist The distribution.
+ * @param a First parameter of the distribution.
+ * @param b Second parameter of the distribution (unused by exponential).
+ */
+void fscl_random_fill(crandom *rng, double *values, size_t count, crandom_dist dist, double a, double b);
+
+/**
+ * Fills a dataset from a distribution on the thread pool. Each fixed-size
+ * chunk draws from its own long-jump stream of `seed`, so the result
+ * depends only on the seed, never on the thread count.
+ *
+ * @param dataset Pointer to the dataset.
+ * @param seed The seed.
+ * @param dist The distribution.
+ * @param a First parameter of the distribution.
+ * @param b Second parameter of the distribution (unused by exponential).
+ */
+void fscl_data_fill_random_ex(cdataset *dataset, uint64_t seed, crandom_dist dist, double a, double b);
+
+/**
+ * Sets the seed used by the next fscl_data_fill_random call; each call
+ * then moves on to a new seed.
+ *
+ * @param seed The seed.
+ */
+void fscl_data_seed_random(uint64_t seed);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif
@@ -0,0 +1,106 @@
+/*
+==============================================================================
+Author: Michael Gene Brockus (Dreamer)
+Email: michaelbrockus@gmail.com
+Organization: Fossil Logic
+Description: 
+    This file is part of the Fossil Logic project, where innovation meets
+    excellence in software development. Michael Gene Brockus, also known as
+    "Dreamer," is a dedicated contributor to this project. For any inquiries,
+    feel free to contact Michael at michaelbrockus@gmail.com.
+==============================================================================
+*/
+#ifndef FSCL_ROLLING_H
+#define FSCL_ROLLING_H
+
+#ifdef __cplusplus
+extern "C"
+{
+#endif
+
+#include "fossil/xscience/dataset.h"
+#include <stdint.h>
+
+// Statistic produced by fscl_data_rolling
+typedef enum {
+    FSCL_ROLLING_MEAN,
+    FSCL_ROLLING_VARIANCE,   // population variance
+    FSCL_ROLLING_STD_DEV,
+    FSCL_ROLLING_MIN,
+    FSCL_ROLLING_MAX
+} crolling_stat;
+
+// Statistics of the last `window` samples, updated in O(1) amortized time
+// per sample. NaN samples take a slot in the window but are excluded
+// from the statistics.
+typedef struct {
+    double *values;       // ring of the last `window` samples
+    uint64_t *low;        // sample numbers with increasing values (min deque)
+    uint64_t *high;       // sample numbers with decreasing values (max deque)
+    size_t low_head, low_size;
+    size_t high_head, high_size;
+    size_t window;
+    uint64_t pushed;      // samples pushed so far
+    size_t count;         // non-NaN samples in the window
+    double sum;
+    double mean;
+    double m2;            // sum of squared deviations from the mean
+} crolling;
+
+// =================================================================
+// Avalible functions
+// =================================================================
+
+/**
+ * Creates an empty rolling window.
+ *
+ * @param rolling Pointer to the window.
+ * @param window Number of samples covered, at least one.
+ * @return 0 on success, -1 if window is zero or memory could not be allocated.
+ */
+int fscl_rolling_create(crolling *rolling, size_t window);
+
+/**
+ * Erases the memory held by a rolling window.
+ *
+ * @param rolling Pointer to the window.
+ */
+void fscl_rolling_erase(crolling *rolling);
+
+/**
+ * Pushes one sample, evicting the oldest once the window is full. The
+ * running sums are recomputed from the window every `window` samples so
+ * rounding errors cannot build up.
+ *
+ * @param rolling Pointer to the window.
+ * @param value The new sample.
+ */
+void fscl_rolling_push(crolling *rolling, double value);
+
+/**
+ * Gets the statistics of the samples currently in the window.
+ *
+ * @param rolling Pointer to the window.
+ * @param stats Pointer to the structure receiving the statistics.
+ */
+void fscl_rolling_stats(const crolling *rolling, cdataset_stats *stats);
+
+/**
+ * Computes a trailing-window statistic for every element: result[i]
+ * covers dataset[i - window + 1 .. i], or fewer elements at the start.
+ * Chunks run on the thread pool, each warmed up with the window before
+ * it, so the result does not depend on the number of threads.
+ *
+ * @param dataset Pointer to the input dataset.
+ * @param window Number of elements per window, at least one.
+ * @param stat The statistic to compute.
+ * @param result Pointer to the dataset to be created with the results.
+ * @return 0 on success, -1 if window is zero or memory could not be allocated.
+ */
+int fscl_data_rolling(const cdataset *dataset, size_t window, crolling_stat stat, cdataset *result);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif
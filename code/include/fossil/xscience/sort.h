@@ -0,0 +1,70 @@
+/*
+==============================================================================
+Author: Michael Gene Brockus (Dreamer)
+Email: michaelbrockus@gmail.com
+Organization: Fossil Logic
+Description: 
+    This file is part of the Fossil Logic project, where innovation meets
+    excellence in software development. Michael Gene Brockus, also known as
+    "Dreamer," is a dedicated contributor to this project. For any inquiries,
+    feel free to contact Michael at michaelbrockus@gmail.com.
+==============================================================================
+*/
+#ifndef FSCL_SORT_H
+#define FSCL_SORT_H
+
+#ifdef __cplusplus
+extern "C"
+{
+#endif
+
+#include "fossil/xscience/dataset.h"
+
+// Where sorting places NaN values; they keep their original order
+typedef enum {
+    FSCL_SORT_NAN_LAST,
+    FSCL_SORT_NAN_FIRST
+} csort_nan;
+
+// =================================================================
+// Avalible functions
+// =================================================================
+
+/**
+ * Sorts a dataset in ascending order with an LSD radix sort on the
+ * IEEE-754 bit patterns (-0.0 sorts before 0.0). Byte positions shared
+ * by every value are skipped. Large datasets are sorted on the thread
+ * pool: every chunk counts its own histogram and scatters its values to
+ * offsets taken from the combined counts.
+ *
+ * @param dataset Pointer to the dataset.
+ * @param nan_policy Where NaN values go.
+ * @return 0 on success, -1 if memory could not be allocated (the dataset is then unchanged).
+ */
+int fscl_data_sort(cdataset *dataset, csort_nan nan_policy);
+
+/**
+ * Computes the stable ascending order of a dataset without moving it.
+ *
+ * @param dataset Pointer to the dataset.
+ * @param nan_policy Where the positions of NaN values go.
+ * @param order Receives dataset->size positions; dataset->data[order[0]] is the smallest value.
+ * @return 0 on success, -1 if memory could not be allocated.
+ */
+int fscl_data_argsort(const cdataset *dataset, csort_nan nan_policy, size_t *order);
+
+/**
+ * Ranks the elements of a dataset from 1 for the smallest; tied values
+ * share the average of their ranks and NaN values get rank NaN.
+ *
+ * @param dataset Pointer to the dataset.
+ * @param ranks Pointer to the dataset to be created with the ranks.
+ * @return 0 on success, -1 if memory could not be allocated.
+ */
+int fscl_data_rank(const cdataset *dataset, cdataset *ranks);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif
@@ -0,0 +1,175 @@
+/*
+==============================================================================
+Author: Michael Gene Brockus (Dreamer)
+Email: michaelbrockus@gmail.com
+Organization: Fossil Logic
+Description: 
+    This file is part of the Fossil Logic project, where innovation meets
+    excellence in software development. Michael Gene Brockus, also known as
+    "Dreamer," is a dedicated contributor to this project. For any inquiries,
+    feel free to contact Michael at michaelbrockus@gmail.com.
+==============================================================================
+*/
+#ifndef FSCL_SPARSE_H
+#define FSCL_SPARSE_H
+
+#ifdef __cplusplus
+extern "C"
+{
+#endif
+
+#include "fossil/xscience/dataset.h"
+#include <stdint.h>
+
+// Code of a missing (NaN) value in a categorical column
+#define FSCL_CATEGORY_MISSING UINT32_MAX
+
+// Compressed sparse row matrix: the entries of row r are
+// values[row_start[r] .. row_start[r + 1]), with columns ascending
+typedef struct {
+    double *values;
+    size_t *columns;
+    size_t *row_start;   // rows + 1 offsets
+    size_t rows;
+    size_t cols;
+    size_t nnz;          // stored entries
+} csparse;
+
+// Dictionary-encoded categorical column
+typedef struct {
+    double *dictionary;  // distinct values in ascending order
+    size_t num_categories;
+    uint32_t *codes;     // dictionary index per row, or FSCL_CATEGORY_MISSING
+    size_t size;
+} ccategorical;
+
+// =================================================================
+// Avalible functions
+// =================================================================
+
+/**
+ * Creates a matrix with room for `nnz` entries and every row empty.
+ *
+ * @param matrix Pointer to the matrix.
+ * @param rows Number of rows.
+ * @param cols Number of columns.
+ * @param nnz Number of entries to allocate.
+ * @return 0 on success, -1 if memory could not be allocated.
+ */
+int fscl_sparse_create(csparse *matrix, size_t rows, size_t cols, size_t nnz);
+
+/**
+ * Erases the memory held by a matrix.
+ *
+ * @param matrix Pointer to the matrix.
+ */
+void fscl_sparse_erase(csparse *matrix);
+
+/**
+ * Builds a matrix from coordinate (COO) triplets in any order. Entries
+ * with the same row and column are summed.
+ *
+ * @param matrix Pointer to the matrix to be created.
+ * @param rows Number of rows.
+ * @param cols Number of columns.
+ * @param row_index Row of every triplet.
+ * @param col_index Column of every triplet.
+ * @param values Value of every triplet.
+ * @param count Number of triplets.
+ * @return 0 on success, -1 on an index out of range or failed allocation.
+ */
+int fscl_sparse_from_coo(csparse *matrix, size_t rows, size_t cols, const size_t *row_index,
+                         const size_t *col_index, const double *values, size_t count);
+
+/**
+ * Builds a matrix from a row-major dense matrix, keeping the non-zero
+ * elements (NaN is kept).
+ *
+ * @param matrix Pointer to the matrix to be created.
+ * @param dataset Pointer to the dataset holding the dense matrix.
+ * @param num_features Number of columns per row.
+ * @return 0 on success, -1 if the size is not a multiple of num_features or allocation failed.
+ */
+int fscl_sparse_from_dense(csparse *matrix, const cdataset *dataset, size_t num_features);
+
+/**
+ * Expands a matrix into a new row-major dense dataset.
+ *
+ * @param matrix Pointer to the matrix.
+ * @param dataset Pointer to the dataset to be created.
+ * @return 0 on success, -1 if memory could not be allocated.
+ */
+int fscl_sparse_to_dense(const csparse *matrix, cdataset *dataset);
+
+/**
+ * Multiplies every stored entry by a factor.
+ *
+ * @param matrix Pointer to the matrix.
+ * @param factor The scaling factor.
+ */
+void fscl_sparse_scale(csparse *matrix, double factor);
+
+/**
+ * Calculates the sum of all elements; the implicit zeros add nothing.
+ *
+ * @param matrix Pointer to the matrix.
+ * @return The sum of the stored entries.
+ */
+double fscl_sparse_sum(const csparse *matrix);
+
+/**
+ * Calculates the dot product of every row with a dense vector. Rows are
+ * split over the thread pool for large matrices.
+ *
+ * @param matrix Pointer to the matrix.
+ * @param vector Pointer to the vector, with one element per column.
+ * @param result Pointer to the dataset to be created, with one element per row.
+ * @return 0 on success, -1 on mismatched sizes or failed allocation.
+ */
+int fscl_sparse_dot_product(const csparse *matrix, const cdataset *vector, cdataset *result);
+
+/**
+ * Dictionary-encodes a dataset: each distinct non-NaN value gets a code,
+ * in ascending order of value.
+ *
+ * @param column Pointer to the categorical column to be created.
+ * @param dataset Pointer to the dataset of categories.
+ * @return 0 on success, -1 if memory could not be allocated.
+ */
+int fscl_categorical_encode(ccategorical *column, const cdataset *dataset);
+
+/**
+ * Erases the memory held by a categorical column.
+ *
+ * @param column Pointer to the column.
+ */
+void fscl_categorical_erase(ccategorical *column);
+
+/**
+ * One-hot encodes a categorical column as a matrix with one row per
+ * element and one column per dictionary entry. Each row stores at most
+ * a single 1.0, so memory grows with the rows, not with the categories.
+ *
+ * @param column Pointer to the categorical column.
+ * @param matrix Pointer to the matrix to be created.
+ * @return 0 on success, -1 if memory could not be allocated.
+ */
+int fscl_categorical_one_hot(const ccategorical *column, csparse *matrix);
+
+/**
+ * One-hot encodes a dataset of categories straight into a sparse matrix,
+ * the sparse counterpart of fscl_data_one_hot_encode.
+ *
+ * @param dataset Pointer to the dataset of categories.
+ * @param matrix Pointer to the matrix to be created.
+ * @param column Receives the dictionary encoding (may be NULL); column j
+ *               of the matrix stands for column->dictionary[j].
+ * @return 0 on success, -1 if memory could not be allocated.
+ */
+int fscl_data_one_hot_sparse(const cdataset *dataset, csparse *matrix, ccategorical *column);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif
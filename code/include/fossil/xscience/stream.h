@@ -0,0 +1,126 @@
+/*
+==============================================================================
+Author: Michael Gene Brockus (Dreamer)
+Email: michaelbrockus@gmail.com
+Organization: Fossil Logic
+Description: 
+    This file is part of the Fossil Logic project, where innovation meets
+    excellence in software development. Michael Gene Brockus, also known as
+    "Dreamer," is a dedicated contributor to this project. For any inquiries,
+    feel free to contact Michael at michaelbrockus@gmail.com.
+==============================================================================
+*/
+#ifndef FSCL_STREAM_H
+#define FSCL_STREAM_H
+
+#ifdef __cplusplus
+extern "C"
+{
+#endif
+
+#include "fossil/xscience/dataset.h"
+#include <stdatomic.h>
+
+// Cache line size used to keep the producer and consumer indices apart
+#define FSCL_STREAM_LINE 64
+
+// Bounded single-producer/single-consumer ring of samples. The producer
+// owns `head`, the consumer owns `tail`; both only grow and are reduced
+// modulo the capacity when indexing, so no lock is ever taken. Each side
+// caches the other side's index and rereads it only when the ring looks
+// full (or empty), keeping the shared cache lines mostly untouched.
+typedef struct {
+    double *data;
+    size_t capacity;   // power of two
+    _Alignas(FSCL_STREAM_LINE) atomic_size_t head;   // samples published
+    size_t cached_tail;                              // producer's copy of tail
+    _Alignas(FSCL_STREAM_LINE) atomic_size_t tail;   // samples consumed
+    size_t cached_head;                              // consumer's copy of head
+} cstream;
+
+// =================================================================
+// Avalible functions
+// =================================================================
+
+/**
+ * Creates an empty stream.
+ *
+ * @param stream Pointer to the stream.
+ * @param capacity Minimum number of samples held; rounded up to a power of two.
+ * @return 0 on success, -1 if capacity is zero or memory could not be allocated.
+ */
+int fscl_stream_create(cstream *stream, size_t capacity);
+
+/**
+ * Erases the memory held by a stream. Neither side may be using it.
+ *
+ * @param stream Pointer to the stream.
+ */
+void fscl_stream_erase(cstream *stream);
+
+/**
+ * Producer side: copies as many samples as fit and publishes them all
+ * with a single release store.
+ *
+ * @param stream Pointer to the stream.
+ * @param values The samples to append.
+ * @param count Number of samples.
+ * @return Number of samples written, less than count when the stream is full.
+ */
+size_t fscl_stream_push(cstream *stream, const double *values, size_t count);
+
+/**
+ * Consumer side: exposes the unconsumed samples as one or two contiguous
+ * views (two when they wrap around the end of the ring). The views stay
+ * valid until fscl_stream_consume releases them, so any cdataset function
+ * that does not modify its input can run on them while the producer keeps
+ * writing behind.
+ *
+ * @param stream Pointer to the stream.
+ * @param views Receives the views; unused entries get size zero.
+ * @return Number of non-empty views (0, 1 or 2).
+ */
+size_t fscl_stream_views(cstream *stream, cdataset views[2]);
+
+/**
+ * Consumer side: releases the oldest samples back to the producer.
+ *
+ * @param stream Pointer to the stream.
+ * @param count Number of samples, clamped to the samples available.
+ * @return Number of samples released.
+ */
+size_t fscl_stream_consume(cstream *stream, size_t count);
+
+/**
+ * Consumer side: copies and releases the oldest samples.
+ *
+ * @param stream Pointer to the stream.
+ * @param values Receives up to count samples.
+ * @param count Maximum number of samples.
+ * @return Number of samples copied.
+ */
+size_t fscl_stream_pop(cstream *stream, double *values, size_t count);
+
+/**
+ * Gets the number of unconsumed samples. Exact from the consumer thread,
+ * a snapshot from anywhere else.
+ *
+ * @param stream Pointer to the stream.
+ * @return Number of samples.
+ */
+size_t fscl_stream_size(const cstream *stream);
+
+/**
+ * Consumer side: computes statistics of the unconsumed samples without
+ * copying or releasing them.
+ *
+ * @param stream Pointer to the stream.
+ * @param stats Pointer to the structure receiving the statistics.
+ */
+void fscl_stream_stats(cstream *stream, cdataset_stats *stats);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif
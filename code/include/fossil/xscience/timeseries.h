@@ -0,0 +1,137 @@
+/*
+==============================================================================
+Author: Michael Gene Brockus (Dreamer)
+Email: michaelbrockus@gmail.com
+Organization: Fossil Logic
+Description: 
+    This file is part of the Fossil Logic project, where innovation meets
+    excellence in software development. Michael Gene Brockus, also known as
+    "Dreamer," is a dedicated contributor to this project. For any inquiries,
+    feel free to contact Michael at michaelbrockus@gmail.com.
+==============================================================================
+*/
+#ifndef FSCL_TIMESERIES_H
+#define FSCL_TIMESERIES_H
+
+#ifdef __cplusplus
+extern "C"
+{
+#endif
+
+#include "fossil/xscience/dataset.h"
+#include <stdint.h>
+
+// Values per compressed block; one decoded block (8 KiB) stays in L1
+#define FSCL_SERIES_BLOCK 1024
+
+// Value predictors; each block keeps whichever encodes smaller
+typedef enum {
+    FSCL_SERIES_PREVIOUS,   // XOR against the previous value (Gorilla)
+    FSCL_SERIES_LINEAR      // XOR against prev + (prev - prevprev), for ramps
+} cseries_predictor;
+
+// Header of one block: where its bits start and the statistics of its values
+typedef struct {
+    uint64_t offset;            // first bit of the block in the stream
+    size_t size;                // number of values, NaN included
+    cseries_predictor predictor;
+    cdataset_stats stats;
+} ctimeseries_block;
+
+// Lossless XOR-compressed series of doubles stored in fixed-size blocks
+typedef struct {
+    uint64_t *bits;
+    uint64_t bit_length;
+    ctimeseries_block *blocks;
+    size_t num_blocks;
+    size_t size;
+} ctimeseries;
+
+// Called once per decoded block with a view of its values and the index of
+// its first value; return nonzero to stop
+typedef int (*ctimeseries_callback)(const cdataset *block, size_t offset, void *context);
+
+// =================================================================
+// Avalible functions
+// =================================================================
+
+/**
+ * Compresses a dataset into a block-compressed series. Values are stored
+ * bit-exactly, NaN included.
+ *
+ * @param series Pointer to the series to be filled.
+ * @param dataset Pointer to the source dataset.
+ * @return 0 on success, -1 if memory could not be allocated.
+ */
+int fscl_series_compress(ctimeseries *series, const cdataset *dataset);
+
+/**
+ * Erases the memory held by a series.
+ *
+ * @param series Pointer to the series to be erased.
+ */
+void fscl_series_erase(ctimeseries *series);
+
+/**
+ * Returns the number of bytes used by the encoded values and block headers.
+ *
+ * @param series Pointer to the series.
+ * @return The compressed size in bytes.
+ */
+size_t fscl_series_bytes(const ctimeseries *series);
+
+/**
+ * Combines the block headers into statistics of the whole series
+ * without decompressing anything.
+ *
+ * @param series Pointer to the series.
+ * @param stats Pointer to the structure receiving the statistics.
+ */
+void fscl_series_stats(const ctimeseries *series, cdataset_stats *stats);
+
+/**
+ * Sums the non-NaN values with index in [begin, end). Whole blocks are
+ * answered from their headers; only the two edge blocks are decoded.
+ *
+ * @param series Pointer to the series.
+ * @param begin Index of the first value.
+ * @param end Index past the last value.
+ * @return The sum of the range.
+ */
+double fscl_series_sum_range(const ctimeseries *series, size_t begin, size_t end);
+
+/**
+ * Decodes one block.
+ *
+ * @param series Pointer to the series.
+ * @param block Index of the block.
+ * @param values Receives up to FSCL_SERIES_BLOCK values.
+ * @return The number of values decoded, 0 if the block does not exist.
+ */
+size_t fscl_series_decode_block(const ctimeseries *series, size_t block, double *values);
+
+/**
+ * Streams the series through a callback, one decoded block at a time,
+ * using a single block-sized buffer.
+ *
+ * @param series Pointer to the series.
+ * @param callback Function receiving each decoded block.
+ * @param context User pointer passed to the callback.
+ * @return 0 when every block was visited, 1 if the callback stopped early.
+ */
+int fscl_series_foreach(const ctimeseries *series, ctimeseries_callback callback, void *context);
+
+/**
+ * Decompresses the whole series into a new dataset.
+ *
+ * @param series Pointer to the series.
+ * @param dataset Pointer to the dataset to be created.
+ * @return 0 on success, -1 if memory could not be allocated.
+ */
+int fscl_series_decompress(const ctimeseries *series, cdataset *dataset);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif
@@ -0,0 +1,110 @@
+/*
+==============================================================================
+Author: Michael Gene Brockus (Dreamer)
+Email: michaelbrockus@gmail.com
+Organization: Fossil Logic
+Description: 
+    This file is part of the Fossil Logic project, where innovation meets
+    excellence in software development. Michael Gene Brockus, also known as
+    "Dreamer," is a dedicated contributor to this project. For any inquiries,
+    feel free to contact Michael at michaelbrockus@gmail.com.
+==============================================================================
+*/
+#ifndef FSCL_TYPEDSET_H
+#define FSCL_TYPEDSET_H
+
+#ifdef __cplusplus
+extern "C"
+{
+#endif
+
+#include "fossil/xscience/dataset.h"
+#include <stdint.h>
+
+// Datasets stored at the native width of the source data; cdataset is the
+// double member of the family
+typedef struct {
+    float *data;
+    size_t size;
+} cdataset_f32;
+
+typedef struct {
+    int32_t *data;
+    size_t size;
+} cdataset_i32;
+
+typedef struct {
+    int16_t *data;
+    size_t size;
+} cdataset_i16;
+
+// =================================================================
+// Avalible functions
+// =================================================================
+
+/**
+ * Declares the typed functions for one element suffix (f32, i32, i16).
+ * Each mirrors the double function of the same name in dataset.h:
+ *
+ *   void   fscl_data_create_S(cdataset_S *dataset, size_t size);
+ *   void   fscl_data_erase_S(cdataset_S *dataset);
+ *   void   fscl_data_stats_S(const cdataset_S *dataset, cdataset_stats *stats);
+ *   double fscl_data_sum_S(const cdataset_S *dataset);
+ *   double fscl_data_mean_S(const cdataset_S *dataset);
+ *   double fscl_data_min_S(const cdataset_S *dataset);
+ *   double fscl_data_max_S(const cdataset_S *dataset);
+ *   double fscl_data_std_dev_S(const cdataset_S *dataset);
+ *   void   fscl_data_scale_S(cdataset_S *dataset, double factor);
+ *   int    fscl_data_to_double_S(const cdataset_S *dataset, cdataset *result);
+ *
+ * Elements are read at their stored width and accumulated in double
+ * (integer sums are exact per chunk). NaN floats follow the double
+ * functions: sum, mean and std_dev return NaN if any element is NaN, while
+ * stats counts and skips them and min and max skip them (NaN when nothing
+ * is left). Scaling integers rounds to the
+ * nearest value and saturates at the limits of the type. to_double
+ * creates `result` and returns -1 if it cannot be allocated.
+ */
+#define FSCL_TYPED_DECLARE(S)                                                       \
+    void fscl_data_create_##S(cdataset_##S *dataset, size_t size);                  \
+    void fscl_data_erase_##S(cdataset_##S *dataset);                                \
+    void fscl_data_stats_##S(const cdataset_##S *dataset, cdataset_stats *stats);   \
+    double fscl_data_sum_##S(const cdataset_##S *dataset);                          \
+    double fscl_data_mean_##S(const cdataset_##S *dataset);                         \
+    double fscl_data_min_##S(const cdataset_##S *dataset);                          \
+    double fscl_data_max_##S(const cdataset_##S *dataset);                          \
+    double fscl_data_std_dev_##S(const cdataset_##S *dataset);                      \
+    void fscl_data_scale_##S(cdataset_##S *dataset, double factor);                 \
+    int fscl_data_to_double_##S(const cdataset_##S *dataset, cdataset *result);
+
+FSCL_TYPED_DECLARE(f32)
+FSCL_TYPED_DECLARE(i32)
+FSCL_TYPED_DECLARE(i16)
+
+// Type-generic front-ends: fscl_data_mean(&ds) picks the function that
+// matches the element type of ds, falling back to the double versions.
+#if !defined(__cplusplus) && defined(__STDC_VERSION__) && __STDC_VERSION__ >= 201112L
+
+#define FSCL_TYPED_DISPATCH(dataset, name) _Generic((dataset),                    \
+    cdataset *: name, const cdataset *: name,                                     \
+    cdataset_f32 *: name##_f32, const cdataset_f32 *: name##_f32,                 \
+    cdataset_i32 *: name##_i32, const cdataset_i32 *: name##_i32,                 \
+    cdataset_i16 *: name##_i16, const cdataset_i16 *: name##_i16)
+
+#define fscl_data_create(dataset, size) FSCL_TYPED_DISPATCH(dataset, fscl_data_create)(dataset, size)
+#define fscl_data_erase(dataset) FSCL_TYPED_DISPATCH(dataset, fscl_data_erase)(dataset)
+#define fscl_data_stats(dataset, stats) FSCL_TYPED_DISPATCH(dataset, fscl_data_stats)(dataset, stats)
+#define fscl_data_sum(dataset) FSCL_TYPED_DISPATCH(dataset, fscl_data_sum)(dataset)
+#define fscl_data_mean(dataset) FSCL_TYPED_DISPATCH(dataset, fscl_data_mean)(dataset)
+#define fscl_data_min(dataset) FSCL_TYPED_DISPATCH(dataset, fscl_data_min)(dataset)
+#define fscl_data_max(dataset) FSCL_TYPED_DISPATCH(dataset, fscl_data_max)(dataset)
+#define fscl_data_std_dev(dataset) FSCL_TYPED_DISPATCH(dataset, fscl_data_std_dev)(dataset)
+#define fscl_data_scale(dataset, factor) FSCL_TYPED_DISPATCH(dataset, fscl_data_scale)(dataset, factor)
+
+#endif
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif
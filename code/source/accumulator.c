@@ -0,0 +1,169 @@
+/*
+==============================================================================
+Author: Michael Gene Brockus (Dreamer)
+Email: michaelbrockus@gmail.com
+Organization: Fossil Logic
+Description: 
+    This file is part of the Fossil Logic project, where innovation meets
+    excellence in software development. Michael Gene Brockus, also known as
+    "Dreamer," is a dedicated contributor to this project. For any inquiries,
+    feel free to contact Michael at michaelbrockus@gmail.com.
+==============================================================================
+*/
+#include "fossil/xscience/accumulator.h"
+#include <string.h>
+
+// Serialized layout: magic "FSAC", u32 version, then seven 64-bit fields
+#define FSCL_ACCUM_MAGIC 0x43415346u
+#define FSCL_ACCUM_VERSION 1u
+
+// Function to store a 64-bit value little-endian
+static void fscl_accum_put(unsigned char *out, uint64_t value) {
+    for (int i = 0; i < 8; ++i) {
+        out[i] = (unsigned char)(value >> (8 * i));
+    }
+}
+
+// Function to load a 64-bit little-endian value
+static uint64_t fscl_accum_get(const unsigned char *in) {
+    uint64_t value = 0;
+    for (int i = 0; i < 8; ++i) {
+        value |= (uint64_t)in[i] << (8 * i);
+    }
+    return value;
+}
+
+static void fscl_accum_put_double(unsigned char *out, double value) {
+    uint64_t bits;
+    memcpy(&bits, &value, sizeof(bits));
+    fscl_accum_put(out, bits);
+}
+
+static double fscl_accum_get_double(const unsigned char *in) {
+    uint64_t bits = fscl_accum_get(in);
+    double value;
+    memcpy(&value, &bits, sizeof(value));
+    return value;
+}
+
+// Function to initialize an empty accumulator
+void fscl_accum_init(caccumulator *accum) {
+    accum->count = 0;
+    accum->nan_count = 0;
+    accum->sum = 0.0;
+    accum->mean = 0.0;
+    accum->m2 = 0.0;
+    accum->min = INFINITY;
+    accum->max = -INFINITY;
+}
+
+// Function to add one value
+void fscl_accum_update(caccumulator *accum, double value) {
+    if (isnan(value)) {
+        ++accum->nan_count;
+        return;
+    }
+
+    ++accum->count;
+    double delta = value - accum->mean;
+    accum->mean += delta / (double)accum->count;
+    accum->m2 += delta * (value - accum->mean);
+    accum->sum += value;
+    if (value < accum->min) accum->min = value;
+    if (value > accum->max) accum->max = value;
+}
+
+// Function to add the summary statistics of a part of the data
+void fscl_accum_update_stats(caccumulator *accum, const cdataset_stats *stats) {
+    caccumulator part;
+    fscl_accum_init(&part);
+    part.nan_count = stats->nan_count;
+    if (stats->count > 0) {
+        part.count = stats->count;
+        part.sum = stats->sum;
+        part.mean = stats->mean;
+        part.m2 = stats->variance * (double)stats->count;
+        part.min = stats->min;
+        part.max = stats->max;
+    }
+    fscl_accum_merge(accum, &part);
+}
+
+// Function to add every value of a dataset
+void fscl_accum_update_data(caccumulator *accum, const cdataset *dataset) {
+    cdataset_stats stats;
+    fscl_data_stats(dataset, &stats);
+    fscl_accum_update_stats(accum, &stats);
+}
+
+// Function to merge two accumulators
+void fscl_accum_merge(caccumulator *accum, const caccumulator *other) {
+    accum->nan_count += other->nan_count;
+    if (other->count == 0) {
+        return;
+    }
+    if (accum->count == 0) {
+        uint64_t nan_count = accum->nan_count;
+        *accum = *other;
+        accum->nan_count = nan_count;
+        return;
+    }
+
+    double count1 = (double)accum->count, count2 = (double)other->count;
+    double total = count1 + count2;
+    double delta = other->mean - accum->mean;
+
+    accum->mean += delta * count2 / total;
+    accum->m2 += other->m2 + delta * delta * (count1 * count2 / total);
+    accum->count += other->count;
+    accum->sum += other->sum;
+    if (other->min < accum->min) accum->min = other->min;
+    if (other->max > accum->max) accum->max = other->max;
+}
+
+// Function to convert an accumulator to summary statistics
+void fscl_accum_stats(const caccumulator *accum, cdataset_stats *stats) {
+    stats->count = (size_t)accum->count;
+    stats->nan_count = (size_t)accum->nan_count;
+    stats->sum = accum->sum;
+    if (accum->count == 0) {
+        stats->mean = NAN;
+        stats->variance = NAN;
+        stats->min = NAN;
+        stats->max = NAN;
+        return;
+    }
+    stats->mean = accum->mean;
+    stats->variance = accum->m2 / (double)accum->count;
+    stats->min = accum->min;
+    stats->max = accum->max;
+}
+
+// Function to serialize an accumulator
+void fscl_accum_serialize(const caccumulator *accum, unsigned char *buffer) {
+    fscl_accum_put(buffer, (uint64_t)FSCL_ACCUM_MAGIC | ((uint64_t)FSCL_ACCUM_VERSION << 32));
+    fscl_accum_put(buffer + 8, accum->count);
+    fscl_accum_put(buffer + 16, accum->nan_count);
+    fscl_accum_put_double(buffer + 24, accum->sum);
+    fscl_accum_put_double(buffer + 32, accum->mean);
+    fscl_accum_put_double(buffer + 40, accum->m2);
+    fscl_accum_put_double(buffer + 48, accum->min);
+    fscl_accum_put_double(buffer + 56, accum->max);
+}
+
+// Function to deserialize an accumulator
+int fscl_accum_deserialize(caccumulator *accum, const unsigned char *buffer) {
+    uint64_t header = fscl_accum_get(buffer);
+    if ((uint32_t)header != FSCL_ACCUM_MAGIC || (header >> 32) != FSCL_ACCUM_VERSION) {
+        return -1;
+    }
+
+    accum->count = fscl_accum_get(buffer + 8);
+    accum->nan_count = fscl_accum_get(buffer + 16);
+    accum->sum = fscl_accum_get_double(buffer + 24);
+    accum->mean = fscl_accum_get_double(buffer + 32);
+    accum->m2 = fscl_accum_get_double(buffer + 40);
+    accum->min = fscl_accum_get_double(buffer + 48);
+    accum->max = fscl_accum_get_double(buffer + 56);
+    return 0;
+}
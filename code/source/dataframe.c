@@ -0,0 +1,181 @@
+/*
+==============================================================================
+Author: Michael Gene Brockus (Dreamer)
+Email: michaelbrockus@gmail.com
+Organization: Fossil Logic
+Description: 
+    This file is part of the Fossil Logic project, where innovation meets
+    excellence in software development. Michael Gene Brockus, also known as
+    "Dreamer," is a dedicated contributor to this project. For any inquiries,
+    feel free to contact Michael at michaelbrockus@gmail.com.
+==============================================================================
+*/
+#include "fossil/xscience/dataframe.h"
+#include <stdint.h>
+#include <string.h>
+
+// Column buffers start on a cache line so SIMD loads never split one
+#define FSCL_DATAFRAME_ALIGN 64
+
+// Function to find the index of a named column
+static cdataframe_column *fscl_dataframe_find(const cdataframe *frame, const char *name) {
+    for (size_t i = 0; i < frame->num_columns; ++i) {
+        if (strcmp(frame->columns[i].name, name) == 0) {
+            return &frame->columns[i];
+        }
+    }
+    return NULL;
+}
+
+// Function to create an empty data frame
+void fscl_dataframe_create(cdataframe *frame, size_t rows) {
+    frame->columns = NULL;
+    frame->num_columns = 0;
+    frame->capacity = 0;
+    frame->rows = rows;
+}
+
+// Function to free the columns appended from `first` on
+static void fscl_dataframe_truncate(cdataframe *frame, size_t first) {
+    while (frame->num_columns > first) {
+        cdataframe_column *column = &frame->columns[--frame->num_columns];
+        fscl_data_index_drop(&column->values);
+        fscl_data_zones_drop(&column->values);
+        free(column->name);
+        free(column->block);
+    }
+}
+
+// Function to erase a data frame
+void fscl_dataframe_erase(cdataframe *frame) {
+    fscl_dataframe_truncate(frame, 0);
+    free(frame->columns);
+    frame->columns = NULL;
+    frame->num_columns = 0;
+    frame->capacity = 0;
+}
+
+// Function to append a zero-filled, cache-line aligned column
+cdataset *fscl_dataframe_add_column(cdataframe *frame, const char *name) {
+    if (fscl_dataframe_find(frame, name) != NULL) {
+        return NULL;
+    }
+
+    if (frame->num_columns == frame->capacity) {
+        size_t capacity = frame->capacity > 0 ? frame->capacity * 2 : 8;
+        cdataframe_column *columns = (cdataframe_column *)realloc(frame->columns, capacity * sizeof(cdataframe_column));
+        if (columns == NULL) {
+            return NULL;
+        }
+        frame->columns = columns;
+        frame->capacity = capacity;
+    }
+
+    size_t length = strlen(name) + 1;
+    char *copy = (char *)malloc(length);
+    void *block = calloc(frame->rows * sizeof(double) + FSCL_DATAFRAME_ALIGN, 1);
+    if (copy == NULL || block == NULL) {
+        free(copy);
+        free(block);
+        return NULL;
+    }
+    memcpy(copy, name, length);
+
+    uintptr_t address = ((uintptr_t)block + FSCL_DATAFRAME_ALIGN - 1) & ~(uintptr_t)(FSCL_DATAFRAME_ALIGN - 1);
+    cdataframe_column *column = &frame->columns[frame->num_columns++];
+    column->name = copy;
+    column->block = block;
+    column->values.data = (double *)address;
+    column->values.size = frame->rows;
+    column->values.ext = NULL;
+    return &column->values;
+}
+
+// Function to look up a column by name
+cdataset *fscl_dataframe_column(const cdataframe *frame, const char *name) {
+    cdataframe_column *column = fscl_dataframe_find(frame, name);
+    return column != NULL ? &column->values : NULL;
+}
+
+// Function to apply a dataset operation to one named column or to all of them
+static void fscl_dataframe_apply(cdataframe *frame, const char *name, void (*operation)(cdataset *)) {
+    if (name != NULL) {
+        cdataframe_column *column = fscl_dataframe_find(frame, name);
+        if (column != NULL) {
+            operation(&column->values);
+        }
+        return;
+    }
+    for (size_t i = 0; i < frame->num_columns; ++i) {
+        operation(&frame->columns[i].values);
+    }
+}
+
+// Function to replace missing values column by column
+void fscl_dataframe_replace_missing(cdataframe *frame, const char *name, double replacement_value) {
+    for (size_t i = 0; i < frame->num_columns; ++i) {
+        if (name == NULL || strcmp(frame->columns[i].name, name) == 0) {
+            fscl_data_replace_missing(&frame->columns[i].values, replacement_value);
+        }
+    }
+}
+
+// Function to standardize columns
+void fscl_dataframe_standardize(cdataframe *frame, const char *name) {
+    fscl_dataframe_apply(frame, name, fscl_data_standardize);
+}
+
+// Function to normalize columns
+void fscl_dataframe_normalize(cdataframe *frame, const char *name) {
+    fscl_dataframe_apply(frame, name, fscl_data_normalize);
+}
+
+// Function to one-hot encode a categorical column into new columns
+size_t fscl_dataframe_one_hot_encode(cdataframe *frame, const char *name) {
+    cdataframe_column *source = fscl_dataframe_find(frame, name);
+    if (source == NULL || frame->rows == 0) {
+        return 0;
+    }
+
+    // Every category must be a whole number small enough to get a column
+    double largest = -1.0;
+    for (size_t row = 0; row < frame->rows; ++row) {
+        double value = source->values.data[row];
+        if (isnan(value) || value < 0.0) {
+            continue;
+        }
+        if (value != floor(value) || value >= (double)FSCL_DATAFRAME_MAX_CATEGORIES) {
+            fprintf(stderr, "Error: Categories must be integers below %d.\n", FSCL_DATAFRAME_MAX_CATEGORIES);
+            return 0;
+        }
+        if (value > largest) {
+            largest = value;
+        }
+    }
+    if (largest < 0.0) {
+        return 0;
+    }
+
+    size_t num_categories = (size_t)largest + 1;
+    size_t first = frame->num_columns;
+    size_t source_index = (size_t)(source - frame->columns);
+    char label[256];
+
+    for (size_t category = 0; category < num_categories; ++category) {
+        snprintf(label, sizeof(label), "%s=%zu", name, category);
+        if (fscl_dataframe_add_column(frame, label) == NULL) {
+            fscl_dataframe_truncate(frame, first);
+            return 0;
+        }
+    }
+
+    // add_column may have moved the column array
+    const double *categories = frame->columns[source_index].values.data;
+    for (size_t row = 0; row < frame->rows; ++row) {
+        double value = categories[row];
+        if (value >= 0.0) {
+            frame->columns[first + (size_t)value].values.data[row] = 1.0;
+        }
+    }
+    return num_categories;
+}
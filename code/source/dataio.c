@@ -0,0 +1,952 @@
+/*
+==============================================================================
+Author: Michael Gene Brockus (Dreamer)
+Email: michaelbrockus@gmail.com
+Organization: Fossil Logic
+Description: 
+    This file is part of the Fossil Logic project, where innovation meets
+    excellence in software development. Michael Gene Brockus, also known as
+    "Dreamer," is a dedicated contributor to this project. For any inquiries,
+    feel free to contact Michael at michaelbrockus@gmail.com.
+==============================================================================
+*/
+#if !defined(_WIN32)
+#define _POSIX_C_SOURCE 200809L
+#endif
+
+#include "fossil/xscience/dataio.h"
+#include "fossil/xscience/parallel.h"
+#include <stdatomic.h>
+#include <stdint.h>
+#include <string.h>
+
+#if defined(__x86_64__) || defined(_M_X64)
+#include <immintrin.h>
+#endif
+
+#if defined(_WIN32)
+#include <malloc.h>
+#include <windows.h>
+#else
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#endif
+
+// Backing storage of a mapped dataset, and on Windows of a loaded one,
+// whose aligned memory must go back through _aligned_free
+typedef struct {
+    void *base;
+    size_t length;
+#if defined(_WIN32)
+    HANDLE mapping;          // NULL for memory from fscl_data_load
+#endif
+} cdataset_mapping;
+
+// Function to map a whole file, hinted for sequential access
+static cdataset_mapping *fscl_data_map_file(const char *path, cdataset_map mode) {
+    cdataset_mapping *mapping = (cdataset_mapping *)malloc(sizeof(cdataset_mapping));
+    if (mapping == NULL) {
+        return NULL;
+    }
+
+#if defined(_WIN32)
+    HANDLE file = CreateFileA(path, GENERIC_READ, FILE_SHARE_READ, NULL, OPEN_EXISTING,
+                              FILE_ATTRIBUTE_NORMAL | FILE_FLAG_SEQUENTIAL_SCAN, NULL);
+    LARGE_INTEGER file_size;
+    if (file == INVALID_HANDLE_VALUE || !GetFileSizeEx(file, &file_size)) {
+        fprintf(stderr, "Error: Unable to open '%s' for mapping.\n", path);
+        if (file != INVALID_HANDLE_VALUE) {
+            CloseHandle(file);
+        }
+        free(mapping);
+        return NULL;
+    }
+    if ((unsigned long long)file_size.QuadPart > SIZE_MAX) {
+        fprintf(stderr, "Error: '%s' is too large to map.\n", path);
+        CloseHandle(file);
+        free(mapping);
+        return NULL;
+    }
+    mapping->length = (size_t)file_size.QuadPart;
+    mapping->base = NULL;
+    mapping->mapping = NULL;
+
+    if (mapping->length > 0) {
+        DWORD protect = mode == FSCL_DATA_MAP_PRIVATE ? PAGE_WRITECOPY : PAGE_READONLY;
+        DWORD access = mode == FSCL_DATA_MAP_PRIVATE ? FILE_MAP_COPY : FILE_MAP_READ;
+        mapping->mapping = CreateFileMappingA(file, NULL, protect, 0, 0, NULL);
+        if (mapping->mapping != NULL) {
+            mapping->base = MapViewOfFile(mapping->mapping, access, 0, 0, 0);
+        }
+        if (mapping->base == NULL) {
+            fprintf(stderr, "Error: Unable to map '%s'.\n", path);
+            if (mapping->mapping != NULL) {
+                CloseHandle(mapping->mapping);
+            }
+            CloseHandle(file);
+            free(mapping);
+            return NULL;
+        }
+    }
+    CloseHandle(file);
+#else
+    int fd = open(path, O_RDONLY);
+    struct stat info;
+    if (fd < 0 || fstat(fd, &info) != 0) {
+        fprintf(stderr, "Error: Unable to open '%s' for mapping.\n", path);
+        if (fd >= 0) {
+            close(fd);
+        }
+        free(mapping);
+        return NULL;
+    }
+    if ((uintmax_t)info.st_size > SIZE_MAX) {
+        fprintf(stderr, "Error: '%s' is too large to map.\n", path);
+        close(fd);
+        free(mapping);
+        return NULL;
+    }
+    mapping->length = (size_t)info.st_size;
+    mapping->base = NULL;
+
+    if (mapping->length > 0) {
+        int protect = mode == FSCL_DATA_MAP_PRIVATE ? PROT_READ | PROT_WRITE : PROT_READ;
+        int flags = mode == FSCL_DATA_MAP_PRIVATE ? MAP_PRIVATE : MAP_SHARED;
+        void *base = mmap(NULL, mapping->length, protect, flags, fd, 0);
+        if (base == MAP_FAILED) {
+            fprintf(stderr, "Error: Unable to map '%s'.\n", path);
+            close(fd);
+            free(mapping);
+            return NULL;
+        }
+        mapping->base = base;
+        // Reductions stream front to back: ask for aggressive read-ahead
+        posix_madvise(base, mapping->length, POSIX_MADV_SEQUENTIAL);
+    }
+    close(fd);
+#endif
+
+    return mapping;
+}
+
+// Function to release a mapping made by fscl_data_map_file
+static void fscl_data_unmap_file(void *storage) {
+    cdataset_mapping *mapping = (cdataset_mapping *)storage;
+#if defined(_WIN32)
+    if (mapping->mapping == NULL) {
+        _aligned_free(mapping->base);
+    } else if (mapping->base != NULL) {
+        UnmapViewOfFile(mapping->base);
+        CloseHandle(mapping->mapping);
+    }
+#else
+    if (mapping->base != NULL) {
+        munmap(mapping->base, mapping->length);
+    }
+#endif
+
+    free(mapping);
+}
+
+// Function to make a mapping the owner of a dataset's buffer; the mapping
+// is released if the dataset cannot take it
+static int fscl_data_attach_mapping(cdataset *dataset, cdataset_mapping *mapping, double *data, size_t size) {
+    if (fscl_data_storage_attach(dataset, mapping, fscl_data_unmap_file) != 0) {
+        fscl_data_unmap_file(mapping);
+        return -1;
+    }
+    dataset->data = data;
+    dataset->size = size;
+    return 0;
+}
+
+// Function to map a file of raw doubles into a dataset
+int fscl_data_open_mmap(cdataset *dataset, const char *path, cdataset_map mode) {
+    dataset->data = NULL;
+    dataset->size = 0;
+    dataset->ext = NULL;
+
+    cdataset_mapping *mapping = fscl_data_map_file(path, mode);
+    if (mapping == NULL) {
+        return -1;
+    }
+    return fscl_data_attach_mapping(dataset, mapping, (double *)mapping->base, mapping->length / sizeof(double));
+}
+
+// Function to unmap a dataset opened with fscl_data_open_mmap
+void fscl_data_close_mmap(cdataset *dataset) {
+    if (fscl_data_storage_get(dataset) != NULL) {
+        fscl_data_erase(dataset);
+    }
+}
+
+// =================================================================
+// Binary dataset files
+// =================================================================
+//
+// Layout: a 64-byte header, the elements in native byte order starting
+// at data_offset (64, so mapped data is cache-line aligned), then an
+// optional table with one entry per block of FSCL_DATA_FILE_BLOCK
+// elements. Checksums are CRC32C over the element bytes as stored.
+
+#define FSCL_DATA_FILE_MAGIC "FSCLDATA"
+#define FSCL_DATA_FILE_VERSION 1
+#define FSCL_DATA_FILE_ORDER 0x01020304u
+#define FSCL_DATA_FILE_FLOAT64 1
+
+// Elements per checksummed block (512 KiB)
+#define FSCL_DATA_FILE_BLOCK ((size_t)1 << 16)
+
+// Alignment of buffers filled by fscl_data_load
+#define FSCL_DATA_FILE_ALIGN 64
+
+#if defined(_WIN32)
+#define fscl_data_file_alloc(bytes) _aligned_malloc(bytes, FSCL_DATA_FILE_ALIGN)
+#define fscl_data_file_free(pointer) _aligned_free(pointer)
+#else
+#define fscl_data_file_alloc(bytes) aligned_alloc(FSCL_DATA_FILE_ALIGN, bytes)
+#define fscl_data_file_free(pointer) free(pointer)
+#endif
+
+// 64-bit file offsets on every platform
+#if defined(_WIN32)
+#define fscl_data_fseek(file, offset, origin) _fseeki64(file, (__int64)(offset), origin)
+#define fscl_data_ftell(file) _ftelli64(file)
+#else
+#define fscl_data_fseek(file, offset, origin) fseeko(file, (off_t)(offset), origin)
+#define fscl_data_ftell(file) ftello(file)
+#endif
+
+typedef struct {
+    char magic[8];
+    uint32_t byte_order;    // FSCL_DATA_FILE_ORDER as written by the saver
+    uint16_t version;
+    uint16_t type;
+    uint32_t flags;
+    uint32_t block_size;    // elements per table entry
+    uint64_t count;
+    uint64_t data_offset;
+    uint64_t table_offset;  // 0 when the file has no table
+    uint32_t reserved;
+    uint32_t header_crc;    // CRC32C of every byte before this field
+    uint8_t padding[8];
+} cdataset_file_header;
+
+typedef struct {
+    uint32_t crc;
+    uint32_t reserved;
+    uint64_t count;
+    uint64_t nan_count;
+    double sum;
+    double mean;
+    double variance;
+    double min;
+    double max;
+} cdataset_file_block;
+
+_Static_assert(sizeof(cdataset_file_header) == 64, "file header must be 64 bytes");
+_Static_assert(sizeof(cdataset_file_block) == 64, "file block must be 64 bytes");
+
+// Reflected CRC32C (Castagnoli) table for the byte-wise fallback
+static const uint32_t fscl_data_crc_table[256] = {
+    0x00000000u, 0xF26B8303u, 0xE13B70F7u, 0x1350F3F4u, 0xC79A971Fu, 0x35F1141Cu,
+    0x26A1E7E8u, 0xD4CA64EBu, 0x8AD958CFu, 0x78B2DBCCu, 0x6BE22838u, 0x9989AB3Bu,
+    0x4D43CFD0u, 0xBF284CD3u, 0xAC78BF27u, 0x5E133C24u, 0x105EC76Fu, 0xE235446Cu,
+    0xF165B798u, 0x030E349Bu, 0xD7C45070u, 0x25AFD373u, 0x36FF2087u, 0xC494A384u,
+    0x9A879FA0u, 0x68EC1CA3u, 0x7BBCEF57u, 0x89D76C54u, 0x5D1D08BFu, 0xAF768BBCu,
+    0xBC267848u, 0x4E4DFB4Bu, 0x20BD8EDEu, 0xD2D60DDDu, 0xC186FE29u, 0x33ED7D2Au,
+    0xE72719C1u, 0x154C9AC2u, 0x061C6936u, 0xF477EA35u, 0xAA64D611u, 0x580F5512u,
+    0x4B5FA6E6u, 0xB93425E5u, 0x6DFE410Eu, 0x9F95C20Du, 0x8CC531F9u, 0x7EAEB2FAu,
+    0x30E349B1u, 0xC288CAB2u, 0xD1D83946u, 0x23B3BA45u, 0xF779DEAEu, 0x05125DADu,
+    0x1642AE59u, 0xE4292D5Au, 0xBA3A117Eu, 0x4851927Du, 0x5B016189u, 0xA96AE28Au,
+    0x7DA08661u, 0x8FCB0562u, 0x9C9BF696u, 0x6EF07595u, 0x417B1DBCu, 0xB3109EBFu,
+    0xA0406D4Bu, 0x522BEE48u, 0x86E18AA3u, 0x748A09A0u, 0x67DAFA54u, 0x95B17957u,
+    0xCBA24573u, 0x39C9C670u, 0x2A993584u, 0xD8F2B687u, 0x0C38D26Cu, 0xFE53516Fu,
+    0xED03A29Bu, 0x1F682198u, 0x5125DAD3u, 0xA34E59D0u, 0xB01EAA24u, 0x42752927u,
+    0x96BF4DCCu, 0x64D4CECFu, 0x77843D3Bu, 0x85EFBE38u, 0xDBFC821Cu, 0x2997011Fu,
+    0x3AC7F2EBu, 0xC8AC71E8u, 0x1C661503u, 0xEE0D9600u, 0xFD5D65F4u, 0x0F36E6F7u,
+    0x61C69362u, 0x93AD1061u, 0x80FDE395u, 0x72966096u, 0xA65C047Du, 0x5437877Eu,
+    0x4767748Au, 0xB50CF789u, 0xEB1FCBADu, 0x197448AEu, 0x0A24BB5Au, 0xF84F3859u,
+    0x2C855CB2u, 0xDEEEDFB1u, 0xCDBE2C45u, 0x3FD5AF46u, 0x7198540Du, 0x83F3D70Eu,
+    0x90A324FAu, 0x62C8A7F9u, 0xB602C312u, 0x44694011u, 0x5739B3E5u, 0xA55230E6u,
+    0xFB410CC2u, 0x092A8FC1u, 0x1A7A7C35u, 0xE811FF36u, 0x3CDB9BDDu, 0xCEB018DEu,
+    0xDDE0EB2Au, 0x2F8B6829u, 0x82F63B78u, 0x709DB87Bu, 0x63CD4B8Fu, 0x91A6C88Cu,
+    0x456CAC67u, 0xB7072F64u, 0xA457DC90u, 0x563C5F93u, 0x082F63B7u, 0xFA44E0B4u,
+    0xE9141340u, 0x1B7F9043u, 0xCFB5F4A8u, 0x3DDE77ABu, 0x2E8E845Fu, 0xDCE5075Cu,
+    0x92A8FC17u, 0x60C37F14u, 0x73938CE0u, 0x81F80FE3u, 0x55326B08u, 0xA759E80Bu,
+    0xB4091BFFu, 0x466298FCu, 0x1871A4D8u, 0xEA1A27DBu, 0xF94AD42Fu, 0x0B21572Cu,
+    0xDFEB33C7u, 0x2D80B0C4u, 0x3ED04330u, 0xCCBBC033u, 0xA24BB5A6u, 0x502036A5u,
+    0x4370C551u, 0xB11B4652u, 0x65D122B9u, 0x97BAA1BAu, 0x84EA524Eu, 0x7681D14Du,
+    0x2892ED69u, 0xDAF96E6Au, 0xC9A99D9Eu, 0x3BC21E9Du, 0xEF087A76u, 0x1D63F975u,
+    0x0E330A81u, 0xFC588982u, 0xB21572C9u, 0x407EF1CAu, 0x532E023Eu, 0xA145813Du,
+    0x758FE5D6u, 0x87E466D5u, 0x94B49521u, 0x66DF1622u, 0x38CC2A06u, 0xCAA7A905u,
+    0xD9F75AF1u, 0x2B9CD9F2u, 0xFF56BD19u, 0x0D3D3E1Au, 0x1E6DCDEEu, 0xEC064EEDu,
+    0xC38D26C4u, 0x31E6A5C7u, 0x22B65633u, 0xD0DDD530u, 0x0417B1DBu, 0xF67C32D8u,
+    0xE52CC12Cu, 0x1747422Fu, 0x49547E0Bu, 0xBB3FFD08u, 0xA86F0EFCu, 0x5A048DFFu,
+    0x8ECEE914u, 0x7CA56A17u, 0x6FF599E3u, 0x9D9E1AE0u, 0xD3D3E1ABu, 0x21B862A8u,
+    0x32E8915Cu, 0xC083125Fu, 0x144976B4u, 0xE622F5B7u, 0xF5720643u, 0x07198540u,
+    0x590AB964u, 0xAB613A67u, 0xB831C993u, 0x4A5A4A90u, 0x9E902E7Bu, 0x6CFBAD78u,
+    0x7FAB5E8Cu, 0x8DC0DD8Fu, 0xE330A81Au, 0x115B2B19u, 0x020BD8EDu, 0xF0605BEEu,
+    0x24AA3F05u, 0xD6C1BC06u, 0xC5914FF2u, 0x37FACCF1u, 0x69E9F0D5u, 0x9B8273D6u,
+    0x88D28022u, 0x7AB90321u, 0xAE7367CAu, 0x5C18E4C9u, 0x4F48173Du, 0xBD23943Eu,
+    0xF36E6F75u, 0x0105EC76u, 0x12551F82u, 0xE03E9C81u, 0x34F4F86Au, 0xC69F7B69u,
+    0xD5CF889Du, 0x27A40B9Eu, 0x79B737BAu, 0x8BDCB4B9u, 0x988C474Du, 0x6AE7C44Eu,
+    0xBE2DA0A5u, 0x4C4623A6u, 0x5F16D052u, 0xAD7D5351u
+};
+
+static uint32_t fscl_data_crc_scalar(uint32_t crc, const unsigned char *bytes, size_t length) {
+    for (size_t i = 0; i < length; ++i) {
+        crc = fscl_data_crc_table[(crc ^ bytes[i]) & 0xFF] ^ (crc >> 8);
+    }
+    return crc;
+}
+
+#if defined(__x86_64__) || defined(_M_X64)
+#define FSCL_DATA_CRC_HW
+#if !defined(_MSC_VER) || defined(__clang__)
+__attribute__((target("sse4.2")))
+#endif
+static uint32_t fscl_data_crc_sse42(uint32_t crc, const unsigned char *bytes, size_t length) {
+    uint64_t value = crc;
+    size_t i = 0;
+    for (; i + 8 <= length; i += 8) {
+        uint64_t word;
+        memcpy(&word, bytes + i, sizeof(word));
+        value = _mm_crc32_u64(value, word);
+    }
+    crc = (uint32_t)value;
+    for (; i < length; ++i) {
+        crc = _mm_crc32_u8(crc, bytes[i]);
+    }
+    return crc;
+}
+#endif
+
+// Function to compute the CRC32C of a buffer
+static uint32_t fscl_data_crc(const void *data, size_t length) {
+    const unsigned char *bytes = (const unsigned char *)data;
+#ifdef FSCL_DATA_CRC_HW
+    // Every CPU with AVX2 also has the SSE4.2 crc32 instruction
+    if (fscl_data_simd_level() >= FSCL_DATA_SIMD_AVX2) {
+        return ~fscl_data_crc_sse42(0xFFFFFFFFu, bytes, length);
+    }
+#endif
+    return ~fscl_data_crc_scalar(0xFFFFFFFFu, bytes, length);
+}
+
+static uint16_t fscl_data_swap16(uint16_t x) {
+    return (uint16_t)((x << 8) | (x >> 8));
+}
+
+static uint32_t fscl_data_swap32(uint32_t x) {
+    return (x << 24) | ((x << 8) & 0x00FF0000u) | ((x >> 8) & 0x0000FF00u) | (x >> 24);
+}
+
+static uint64_t fscl_data_swap64(uint64_t x) {
+    return ((uint64_t)fscl_data_swap32((uint32_t)x) << 32) | fscl_data_swap32((uint32_t)(x >> 32));
+}
+
+// Function to byte-swap an array of 8-byte values in place
+static void fscl_data_swap_words(void *data, size_t count) {
+    unsigned char *bytes = (unsigned char *)data;
+    for (size_t i = 0; i < count; ++i) {
+        uint64_t word;
+        memcpy(&word, bytes + i * 8, sizeof(word));
+        word = fscl_data_swap64(word);
+        memcpy(bytes + i * 8, &word, sizeof(word));
+    }
+}
+
+// Function to check a header read from disk; swaps it to native order
+// and reports whether the file was written with the other byte order
+static int fscl_data_file_check(cdataset_file_header *header, uint64_t length, int *swapped, const char *path) {
+    if (length < sizeof(*header) || memcmp(header->magic, FSCL_DATA_FILE_MAGIC, 8) != 0) {
+        fprintf(stderr, "Error: '%s' is not a dataset file.\n", path);
+        return -1;
+    }
+    if (fscl_data_crc(header, offsetof(cdataset_file_header, header_crc)) !=
+        (header->byte_order == FSCL_DATA_FILE_ORDER ? header->header_crc : fscl_data_swap32(header->header_crc))) {
+        fprintf(stderr, "Error: Header checksum mismatch in '%s'.\n", path);
+        return -1;
+    }
+
+    *swapped = header->byte_order != FSCL_DATA_FILE_ORDER;
+    if (*swapped) {
+        header->version = fscl_data_swap16(header->version);
+        header->type = fscl_data_swap16(header->type);
+        header->flags = fscl_data_swap32(header->flags);
+        header->block_size = fscl_data_swap32(header->block_size);
+        header->count = fscl_data_swap64(header->count);
+        header->data_offset = fscl_data_swap64(header->data_offset);
+        header->table_offset = fscl_data_swap64(header->table_offset);
+    }
+
+    uint64_t blocks = header->block_size > 0 ? (header->count + header->block_size - 1) / header->block_size : 0;
+    if (header->version != FSCL_DATA_FILE_VERSION || header->type != FSCL_DATA_FILE_FLOAT64 ||
+        header->data_offset < sizeof(*header) || header->data_offset % sizeof(double) != 0 ||
+        header->data_offset > length || header->count > (length - header->data_offset) / sizeof(double) ||
+        (header->table_offset != 0 && (header->block_size == 0 || header->table_offset > length ||
+         blocks > (length - header->table_offset) / sizeof(cdataset_file_block))) ||
+        // A checksum or statistics flag needs the table behind it
+        (header->flags != 0 && (header->block_size == 0 || (header->count > 0 && header->table_offset == 0)))) {
+        fprintf(stderr, "Error: Unsupported or truncated dataset file '%s'.\n", path);
+        return -1;
+    }
+    return 0;
+}
+
+// Shared state of the per-block checksum and statistics pass
+typedef struct {
+    const double *data;
+    cdataset_file_block *blocks;
+    size_t block_size;
+    unsigned flags;
+    atomic_int failed;       // set by verification when a checksum differs
+} cdataset_file_job;
+
+static void fscl_data_file_summarize(void *context, size_t begin, size_t end) {
+    cdataset_file_job *job = (cdataset_file_job *)context;
+    cdataset_file_block *block = &job->blocks[begin / job->block_size];
+    memset(block, 0, sizeof(*block));
+
+    if (job->flags & FSCL_DATA_FILE_CHECKSUMS) {
+        block->crc = fscl_data_crc(job->data + begin, (end - begin) * sizeof(double));
+    }
+    if (job->flags & FSCL_DATA_FILE_STATS) {
+        cdataset view = {(double *)job->data + begin, end - begin, NULL};
+        cdataset_stats stats;
+        fscl_data_stats(&view, &stats);
+        block->count = stats.count;
+        block->nan_count = stats.nan_count;
+        block->sum = stats.sum;
+        block->mean = stats.mean;
+        block->variance = stats.variance;
+        block->min = stats.min;
+        block->max = stats.max;
+    }
+}
+
+static void fscl_data_file_verify(void *context, size_t begin, size_t end) {
+    cdataset_file_job *job = (cdataset_file_job *)context;
+    const cdataset_file_block *block = &job->blocks[begin / job->block_size];
+    if (fscl_data_crc(job->data + begin, (end - begin) * sizeof(double)) != block->crc) {
+        atomic_store_explicit(&job->failed, 1, memory_order_relaxed);
+    }
+}
+
+// Function to open a binary file and read its checked header
+static FILE *fscl_data_file_open(const char *path, cdataset_file_header *header, int *swapped) {
+    FILE *file = fopen(path, "rb");
+    if (file == NULL) {
+        fprintf(stderr, "Error: Unable to open '%s'.\n", path);
+        return NULL;
+    }
+
+    int64_t length = -1;
+    if (fscl_data_fseek(file, 0, SEEK_END) == 0) {
+        length = (int64_t)fscl_data_ftell(file);
+    }
+    if (length < 0 || fscl_data_fseek(file, 0, SEEK_SET) != 0 || fread(header, sizeof(*header), 1, file) != 1) {
+        memset(header, 0, sizeof(*header));
+        length = 0;
+    }
+    if (fscl_data_file_check(header, (uint64_t)length, swapped, path) != 0) {
+        fclose(file);
+        return NULL;
+    }
+    return file;
+}
+
+// Function to save a dataset to a binary file
+int fscl_data_save(const cdataset *dataset, const char *path, unsigned flags) {
+    cdataset_file_header header;
+    memset(&header, 0, sizeof(header));
+    memcpy(header.magic, FSCL_DATA_FILE_MAGIC, 8);
+    header.byte_order = FSCL_DATA_FILE_ORDER;
+    header.version = FSCL_DATA_FILE_VERSION;
+    header.type = FSCL_DATA_FILE_FLOAT64;
+    header.flags = flags & (FSCL_DATA_FILE_CHECKSUMS | FSCL_DATA_FILE_STATS);
+    header.block_size = (uint32_t)FSCL_DATA_FILE_BLOCK;
+    header.count = dataset->size;
+    header.data_offset = sizeof(header);
+
+    size_t blocks = (dataset->size + FSCL_DATA_FILE_BLOCK - 1) / FSCL_DATA_FILE_BLOCK;
+    cdataset_file_job job = {dataset->data, NULL, FSCL_DATA_FILE_BLOCK, header.flags, 0};
+    if (header.flags != 0 && blocks > 0) {
+        job.blocks = (cdataset_file_block *)malloc(blocks * sizeof(cdataset_file_block));
+        if (job.blocks == NULL) {
+            fprintf(stderr, "Error: Memory allocation failed for dataset file table.\n");
+            return -1;
+        }
+        fscl_data_for(FSCL_DATA_EXEC_DEFAULT, dataset->size, FSCL_DATA_FILE_BLOCK, fscl_data_file_summarize, &job);
+        header.table_offset = header.data_offset + (uint64_t)dataset->size * sizeof(double);
+    }
+    header.header_crc = fscl_data_crc(&header, offsetof(cdataset_file_header, header_crc));
+
+    FILE *file = fopen(path, "wb");
+    if (file == NULL) {
+        fprintf(stderr, "Error: Unable to create '%s'.\n", path);
+        free(job.blocks);
+        return -1;
+    }
+
+    // Three sequential writes: header, elements, table
+    int ok = fwrite(&header, sizeof(header), 1, file) == 1 &&
+             (dataset->size == 0 || fwrite(dataset->data, sizeof(double), dataset->size, file) == dataset->size) &&
+             (job.blocks == NULL || fwrite(job.blocks, sizeof(cdataset_file_block), blocks, file) == blocks);
+    ok = fclose(file) == 0 && ok;
+    free(job.blocks);
+
+    if (!ok) {
+        fprintf(stderr, "Error: Unable to write '%s'.\n", path);
+        return -1;
+    }
+    return 0;
+}
+
+// Function to load a binary file into aligned memory
+int fscl_data_load(cdataset *dataset, const char *path) {
+    dataset->data = NULL;
+    dataset->size = 0;
+    dataset->ext = NULL;
+
+    cdataset_file_header header;
+    int swapped = 0;
+    FILE *file = fscl_data_file_open(path, &header, &swapped);
+    if (file == NULL) {
+        return -1;
+    }
+
+    size_t count = (size_t)header.count;
+    size_t bytes = (count * sizeof(double) + FSCL_DATA_FILE_ALIGN - 1) & ~(size_t)(FSCL_DATA_FILE_ALIGN - 1);
+    size_t blocks = header.table_offset != 0 ? (count + header.block_size - 1) / header.block_size : 0;
+    double *data = (double *)fscl_data_file_alloc(bytes > 0 ? bytes : FSCL_DATA_FILE_ALIGN);
+    cdataset_file_block *table = (cdataset_file_block *)malloc((blocks > 0 ? blocks : 1) * sizeof(cdataset_file_block));
+    if (data == NULL || table == NULL) {
+        fprintf(stderr, "Error: Memory allocation failed for dataset.\n");
+        fscl_data_file_free(data);
+        free(table);
+        fclose(file);
+        return -1;
+    }
+
+    // One read for all the elements, one for the table
+    int ok = fscl_data_fseek(file, header.data_offset, SEEK_SET) == 0 &&
+             fread(data, sizeof(double), count, file) == count;
+    if (ok && blocks > 0) {
+        ok = fscl_data_fseek(file, header.table_offset, SEEK_SET) == 0 &&
+             fread(table, sizeof(cdataset_file_block), blocks, file) == blocks;
+    }
+    fclose(file);
+    if (!ok) {
+        fprintf(stderr, "Error: Unable to read '%s'.\n", path);
+        fscl_data_file_free(data);
+        free(table);
+        return -1;
+    }
+
+    if ((header.flags & FSCL_DATA_FILE_CHECKSUMS) && blocks > 0) {
+        if (swapped) {
+            for (size_t b = 0; b < blocks; ++b) {
+                table[b].crc = fscl_data_swap32(table[b].crc);
+            }
+        }
+        cdataset_file_job job = {data, table, header.block_size, header.flags, 0};
+        fscl_data_for(FSCL_DATA_EXEC_DEFAULT, count, header.block_size, fscl_data_file_verify, &job);
+        if (atomic_load_explicit(&job.failed, memory_order_relaxed)) {
+            fprintf(stderr, "Error: Checksum mismatch in '%s'.\n", path);
+            fscl_data_file_free(data);
+            free(table);
+            return -1;
+        }
+    }
+    free(table);
+
+    if (swapped) {
+        fscl_data_swap_words(data, count);
+    }
+#if defined(_WIN32)
+    // Windows cannot release aligned memory with free(): fscl_data_erase
+    // goes through the storage record instead
+    cdataset_mapping *storage = (cdataset_mapping *)malloc(sizeof(cdataset_mapping));
+    if (storage == NULL) {
+        fprintf(stderr, "Error: Memory allocation failed for dataset.\n");
+        _aligned_free(data);
+        return -1;
+    }
+    storage->base = data;
+    storage->length = bytes;
+    storage->mapping = NULL;
+    return fscl_data_attach_mapping(dataset, storage, data, count);
+#else
+    dataset->data = data;
+    dataset->size = count;
+    return 0;
+#endif
+}
+
+// Function to map a binary file into a dataset without copying
+int fscl_data_load_mmap(cdataset *dataset, const char *path, cdataset_map mode) {
+    dataset->data = NULL;
+    dataset->size = 0;
+    dataset->ext = NULL;
+
+    cdataset_mapping *mapping = fscl_data_map_file(path, mode);
+    if (mapping == NULL) {
+        return -1;
+    }
+
+    cdataset_file_header header;
+    int swapped = 0;
+    memset(&header, 0, sizeof(header));
+    if (mapping->length >= sizeof(header)) {
+        memcpy(&header, mapping->base, sizeof(header));
+    }
+    if (fscl_data_file_check(&header, mapping->length, &swapped, path) != 0 || swapped) {
+        if (swapped) {
+            fprintf(stderr, "Error: '%s' has foreign byte order; use fscl_data_load.\n", path);
+        }
+        fscl_data_unmap_file(mapping);
+        return -1;
+    }
+
+    return fscl_data_attach_mapping(dataset, mapping, (double *)((char *)mapping->base + header.data_offset),
+                                    (size_t)header.count);
+}
+
+// Function to read the statistics of a binary file from its table
+int fscl_data_file_stats(const char *path, cdataset_stats *stats) {
+    cdataset_file_header header;
+    int swapped = 0;
+    FILE *file = fscl_data_file_open(path, &header, &swapped);
+    if (file == NULL) {
+        return -1;
+    }
+    if (!(header.flags & FSCL_DATA_FILE_STATS) || fscl_data_fseek(file, header.table_offset, SEEK_SET) != 0) {
+        fclose(file);
+        return -1;
+    }
+
+    memset(stats, 0, sizeof(*stats));
+    size_t blocks = (size_t)((header.count + header.block_size - 1) / header.block_size);
+    for (size_t b = 0; b < blocks; ++b) {
+        cdataset_file_block block;
+        if (fread(&block, sizeof(block), 1, file) != 1) {
+            fclose(file);
+            return -1;
+        }
+        if (swapped) {
+            fscl_data_swap_words(&block.count, 7);
+        }
+        cdataset_stats part = {(size_t)block.count, (size_t)block.nan_count, block.sum, block.mean,
+                               block.variance, block.min, block.max};
+        fscl_data_stats_merge(stats, &part);
+    }
+    fclose(file);
+
+    if (stats->count == 0) {
+        stats->mean = NAN;
+        stats->variance = NAN;
+        stats->min = NAN;
+        stats->max = NAN;
+    }
+    return 0;
+}
+
+// =================================================================
+// Streaming CSV reader
+// =================================================================
+
+// Initial size of the raw read buffer; grown only for longer lines
+#define FSCL_DATA_CSV_BUFFER 65536
+
+// Powers of ten that are exact in a double
+static const double fscl_data_csv_pow10[] = {
+    1e0,  1e1,  1e2,  1e3,  1e4,  1e5,  1e6,  1e7,  1e8,  1e9,  1e10, 1e11,
+    1e12, 1e13, 1e14, 1e15, 1e16, 1e17, 1e18, 1e19, 1e20, 1e21, 1e22
+};
+
+// Function to compare a field against a keyword, ignoring case
+static int fscl_data_csv_keyword(const char *p, const char *end, const char *word) {
+    for (; *word != '\0'; ++p, ++word) {
+        if (p == end || (*p | 0x20) != *word) {
+            return 0;
+        }
+    }
+    return p == end;
+}
+
+// Function to parse one trimmed field; returns NaN if it is not a number.
+// Decimal inputs with at most 15 significant digits and a small exponent
+// take the exact fast path; anything else is handed to strtod.
+static double fscl_data_csv_parse(const char *p, const char *end) {
+    const char *start = p;
+    int negative = 0;
+    if (p < end && (*p == '-' || *p == '+')) {
+        negative = *p == '-';
+        ++p;
+    }
+
+    uint64_t mantissa = 0;
+    int digits = 0, exponent = 0, seen_digit = 0;
+    for (; p < end && *p >= '0' && *p <= '9'; ++p) {
+        seen_digit = 1;
+        if (digits < 19) {
+            mantissa = mantissa * 10 + (uint64_t)(*p - '0');
+            if (mantissa != 0) ++digits;
+        } else {
+            ++exponent;
+            ++digits;
+        }
+    }
+    if (p < end && *p == '.') {
+        for (++p; p < end && *p >= '0' && *p <= '9'; ++p) {
+            seen_digit = 1;
+            if (digits < 19) {
+                mantissa = mantissa * 10 + (uint64_t)(*p - '0');
+                if (mantissa != 0) ++digits;
+                --exponent;
+            }
+        }
+    }
+    if (!seen_digit) {
+        p = start + (p > start && (*start == '-' || *start == '+'));
+        if (fscl_data_csv_keyword(p, end, "inf") || fscl_data_csv_keyword(p, end, "infinity")) {
+            return negative ? -INFINITY : INFINITY;
+        }
+        return NAN;
+    }
+    if (p < end && (*p == 'e' || *p == 'E')) {
+        int exp_negative = 0, exp_value = 0;
+        ++p;
+        if (p < end && (*p == '-' || *p == '+')) {
+            exp_negative = *p == '-';
+            ++p;
+        }
+        if (p == end || *p < '0' || *p > '9') {
+            return NAN;
+        }
+        for (; p < end && *p >= '0' && *p <= '9'; ++p) {
+            if (exp_value < 10000) {
+                exp_value = exp_value * 10 + (*p - '0');
+            }
+        }
+        exponent += exp_negative ? -exp_value : exp_value;
+    }
+    if (p != end) {
+        return NAN;
+    }
+
+    if (digits <= 15 && exponent >= -22 && exponent <= 22) {
+        double value = (double)mantissa;
+        value = exponent < 0 ? value / fscl_data_csv_pow10[-exponent] : value * fscl_data_csv_pow10[exponent];
+        return negative ? -value : value;
+    }
+
+    // strtod needs a terminated copy; long expansions written by other
+    // tools get one on the heap
+    char token[64];
+    size_t length = (size_t)(end - start);
+    char *copy = length < sizeof(token) ? token : (char *)malloc(length + 1);
+    if (copy == NULL) {
+        fprintf(stderr, "Error: Memory allocation failed for CSV field.\n");
+        return NAN;
+    }
+    memcpy(copy, start, length);
+    copy[length] = '\0';
+    double value = strtod(copy, NULL);
+    if (copy != token) {
+        free(copy);
+    }
+    return value;
+}
+
+// Function to locate the next complete line, refilling the buffer as needed.
+// Returns 0 at end of file; otherwise sets [line, line_end) without the newline.
+static int fscl_data_csv_line(cdataset_csv *reader, const char **line, const char **line_end) {
+    for (;;) {
+        char *start = reader->buffer + reader->begin;
+        size_t available = reader->end - reader->begin;
+        char *newline = (char *)memchr(start, '\n', available);
+
+        if (newline != NULL || (reader->eof && available > 0)) {
+            char *stop = newline != NULL ? newline : start + available;
+            reader->begin = newline != NULL ? (size_t)(newline - reader->buffer) + 1 : reader->end;
+            if (stop > start && stop[-1] == '\r') {
+                --stop;
+            }
+            *line = start;
+            *line_end = stop;
+            return 1;
+        }
+        if (reader->eof) {
+            return 0;
+        }
+
+        // Move the partial line to the front, growing only if it fills the buffer
+        memmove(reader->buffer, start, available);
+        reader->begin = 0;
+        reader->end = available;
+        if (available == reader->capacity) {
+            char *grown = (char *)realloc(reader->buffer, reader->capacity * 2);
+            if (grown == NULL) {
+                reader->eof = 1;
+                continue;
+            }
+            reader->buffer = grown;
+            reader->capacity *= 2;
+        }
+        size_t read = fread(reader->buffer + reader->end, 1, reader->capacity - reader->end, reader->file);
+        reader->end += read;
+        if (read == 0) {
+            reader->eof = 1;
+        }
+    }
+}
+
+// Function to trim blanks and optional quotes around a field
+static void fscl_data_csv_trim(const char **begin, const char **end) {
+    while (*begin < *end && (**begin == ' ' || **begin == '\t')) ++*begin;
+    while (*end > *begin && ((*end)[-1] == ' ' || (*end)[-1] == '\t')) --*end;
+    if (*end - *begin >= 2 && **begin == '"' && (*end)[-1] == '"') {
+        ++*begin;
+        --*end;
+    }
+}
+
+// Function to open a delimited text file for chunked reading
+int fscl_data_csv_open(cdataset_csv *reader, const char *path, char delimiter, int has_header, size_t chunk_rows) {
+    memset(reader, 0, sizeof(*reader));
+    reader->delimiter = delimiter;
+    reader->chunk_rows = chunk_rows > 0 ? chunk_rows : 1;
+    reader->capacity = FSCL_DATA_CSV_BUFFER;
+
+    reader->file = fopen(path, "rb");
+    if (reader->file == NULL) {
+        fprintf(stderr, "Error: Unable to open '%s'.\n", path);
+        return -1;
+    }
+    reader->buffer = (char *)malloc(reader->capacity);
+    if (reader->buffer == NULL) {
+        fscl_data_csv_close(reader);
+        return -1;
+    }
+
+    // The first non-blank line fixes the column count
+    const char *line = NULL, *line_end = NULL;
+    int found;
+    while ((found = fscl_data_csv_line(reader, &line, &line_end)) && line == line_end) {
+        continue;
+    }
+
+    if (found) {
+        reader->columns = 1;
+        for (const char *p = line; p < line_end; ++p) {
+            if (*p == delimiter) {
+                ++reader->columns;
+            }
+        }
+        if (!has_header) {
+            // Parse it again as data on the first chunk
+            reader->begin = (size_t)(line - reader->buffer);
+        }
+    }
+
+    reader->values = (double *)malloc((reader->columns > 0 ? reader->columns : 1) * reader->chunk_rows * sizeof(double));
+    if (reader->values == NULL) {
+        fscl_data_csv_close(reader);
+        return -1;
+    }
+    return 0;
+}
+
+// Function to parse the next chunk of rows
+size_t fscl_data_csv_next(cdataset_csv *reader) {
+    const char *line, *line_end;
+    size_t columns = reader->columns;
+    size_t stride = reader->chunk_rows;
+
+    reader->rows = 0;
+    if (columns == 0) {
+        return 0;
+    }
+    while (reader->rows < reader->chunk_rows && fscl_data_csv_line(reader, &line, &line_end)) {
+        if (line == line_end) {
+            continue;
+        }
+
+        double *out = reader->values + reader->rows;
+        const char *field = line;
+        size_t column = 0;
+        while (column < columns) {
+            const char *stop = field;
+            while (stop < line_end && *stop != reader->delimiter) {
+                ++stop;
+            }
+            const char *begin = field, *end = stop;
+            fscl_data_csv_trim(&begin, &end);
+            out[column * stride] = begin == end ? NAN : fscl_data_csv_parse(begin, end);
+            ++column;
+            if (stop == line_end) {
+                break;
+            }
+            field = stop + 1;
+        }
+        for (; column < columns; ++column) {
+            out[column * stride] = NAN;
+        }
+        ++reader->rows;
+    }
+    return reader->rows;
+}
+
+// Function to view one column of the current chunk
+cdataset fscl_data_csv_column(const cdataset_csv *reader, size_t column) {
+    cdataset view = {NULL, 0, NULL};
+    if (column < reader->columns) {
+        view.data = reader->values + column * reader->chunk_rows;
+        view.size = reader->rows;
+    }
+    return view;
+}
+
+// Function to close the reader
+void fscl_data_csv_close(cdataset_csv *reader) {
+    if (reader->file != NULL) {
+        fclose(reader->file);
+    }
+    free(reader->buffer);
+    free(reader->values);
+    memset(reader, 0, sizeof(*reader));
+}
+
+// Function to stream a delimited text file through a callback
+int fscl_data_csv_foreach(const char *path, char delimiter, int has_header, size_t chunk_rows,
+                          cdataset_csv_callback callback, void *context) {
+    cdataset_csv reader;
+    if (fscl_data_csv_open(&reader, path, delimiter, has_header, chunk_rows) != 0) {
+        return -1;
+    }
+
+    cdataset *columns = (cdataset *)malloc((reader.columns > 0 ? reader.columns : 1) * sizeof(cdataset));
+    if (columns == NULL) {
+        fscl_data_csv_close(&reader);
+        return -1;
+    }
+
+    int status = 0;
+    while (status == 0 && fscl_data_csv_next(&reader) > 0) {
+        for (size_t c = 0; c < reader.columns; ++c) {
+            columns[c] = fscl_data_csv_column(&reader, c);
+        }
+        if (callback(columns, reader.columns, context) != 0) {
+            status = 1;
+        }
+    }
+
+    free(columns);
+    fscl_data_csv_close(&reader);
+    return status;
+}
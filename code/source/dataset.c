@@ -11,16 +11,1104 @@ Description:
 ==============================================================================
 */
 #include "fossil/xscience/dataset.h"
+#include "fossil/xscience/parallel.h"
+#include "fossil/xscience/accumulator.h"
+#include <string.h>
+#include <stdint.h>
+
+#if defined(__x86_64__) || defined(_M_X64) || defined(__i386__) || defined(_M_IX86)
+#define FSCL_DATA_X86
+#include <immintrin.h>
+#if defined(_MSC_VER) && !defined(__clang__)
+#include <intrin.h>
+#define FSCL_DATA_TARGET(isa)
+#else
+#define FSCL_DATA_TARGET(isa) __attribute__((target(isa)))
+#endif
+#endif
+
+// =================================================================
+// Reduction kernels
+// =================================================================
+//
+// Every kernel keeps four independent accumulators so the loop is not
+// bound by the latency of a single add/min/max chain. The table matching
+// the host CPU is selected once and used by the public functions below.
+// The min/max kernels require size >= 1 and keep the scalar semantics of
+// `if (x < min) min = x`: NaN elements are skipped unless data[0] is NaN.
+// The compact kernels move the elements with low <= x <= high (never NaN)
+// to the front in order and return how many were kept; writes trail the
+// reads, so they work in place in a single sweep. The stats_lanes kernels
+// compute the statistics of up to FSCL_DATA_BATCH_LANES short series side
+// by side, one accumulator per series, with two passes (sum, then squared
+// deviations) that stay in L1.
+
+// Series processed side by side by the stats_lanes kernels
+#define FSCL_DATA_BATCH_LANES 4
+
+typedef struct {
+    cdataset_simd level;
+    double (*sum)(const double *data, size_t size);
+    double (*min)(const double *data, size_t size);
+    double (*max)(const double *data, size_t size);
+    double (*dot)(const double *data1, const double *data2, size_t size);
+    size_t (*compact)(double *data, size_t size, double low, double high);
+    void (*stats_lanes)(const double *const *data, const size_t *sizes, size_t lanes, cdataset_stats **out);
+} cdataset_kernels;
+
+// Function to fold data[begin, end) of one series into its first-pass sums
+static void fscl_data_lane_sums(const double *data, size_t begin, size_t end, size_t *count,
+                                double *sum, double *min_val, double *max_val) {
+    for (size_t i = begin; i < end; ++i) {
+        double value = data[i];
+        if (isnan(value)) {
+            continue;
+        }
+        ++*count;
+        *sum += value;
+        if (value < *min_val) *min_val = value;
+        if (value > *max_val) *max_val = value;
+    }
+}
+
+// Function to add the squared deviations of data[begin, end)
+static double fscl_data_lane_m2(const double *data, size_t begin, size_t end, double mean) {
+    double m2 = 0.0;
+    for (size_t i = begin; i < end; ++i) {
+        double diff = data[i] - mean;
+        if (!isnan(diff)) {
+            m2 += diff * diff;
+        }
+    }
+    return m2;
+}
+
+// Function to store the statistics of one finished series
+static void fscl_data_lane_store(cdataset_stats *stats, size_t size, size_t count, double sum,
+                                 double m2, double min_val, double max_val) {
+    stats->count = count;
+    stats->nan_count = size - count;
+    stats->sum = sum;
+    if (count == 0) {
+        stats->mean = NAN;
+        stats->variance = NAN;
+        stats->min = NAN;
+        stats->max = NAN;
+        return;
+    }
+    stats->mean = sum / (double)count;
+    stats->variance = m2 / (double)count;
+    stats->min = min_val;
+    stats->max = max_val;
+}
+
+static double fscl_data_sum_scalar(const double *data, size_t size) {
+    double s0 = 0.0, s1 = 0.0, s2 = 0.0, s3 = 0.0;
+    size_t i = 0;
+    for (; i + 4 <= size; i += 4) {
+        s0 += data[i];
+        s1 += data[i + 1];
+        s2 += data[i + 2];
+        s3 += data[i + 3];
+    }
+    for (; i < size; ++i) {
+        s0 += data[i];
+    }
+    return (s0 + s1) + (s2 + s3);
+}
+
+static double fscl_data_min_scalar(const double *data, size_t size) {
+    double m0 = data[0], m1 = data[0], m2 = data[0], m3 = data[0];
+    size_t i = 1;
+    for (; i + 4 <= size; i += 4) {
+        if (data[i] < m0) m0 = data[i];
+        if (data[i + 1] < m1) m1 = data[i + 1];
+        if (data[i + 2] < m2) m2 = data[i + 2];
+        if (data[i + 3] < m3) m3 = data[i + 3];
+    }
+    for (; i < size; ++i) {
+        if (data[i] < m0) m0 = data[i];
+    }
+    if (m1 < m0) m0 = m1;
+    if (m2 < m0) m0 = m2;
+    if (m3 < m0) m0 = m3;
+    return m0;
+}
+
+static double fscl_data_max_scalar(const double *data, size_t size) {
+    double m0 = data[0], m1 = data[0], m2 = data[0], m3 = data[0];
+    size_t i = 1;
+    for (; i + 4 <= size; i += 4) {
+        if (data[i] > m0) m0 = data[i];
+        if (data[i + 1] > m1) m1 = data[i + 1];
+        if (data[i + 2] > m2) m2 = data[i + 2];
+        if (data[i + 3] > m3) m3 = data[i + 3];
+    }
+    for (; i < size; ++i) {
+        if (data[i] > m0) m0 = data[i];
+    }
+    if (m1 > m0) m0 = m1;
+    if (m2 > m0) m0 = m2;
+    if (m3 > m0) m0 = m3;
+    return m0;
+}
+
+static double fscl_data_dot_scalar(const double *data1, const double *data2, size_t size) {
+    double s0 = 0.0, s1 = 0.0, s2 = 0.0, s3 = 0.0;
+    size_t i = 0;
+    for (; i + 4 <= size; i += 4) {
+        s0 += data1[i] * data2[i];
+        s1 += data1[i + 1] * data2[i + 1];
+        s2 += data1[i + 2] * data2[i + 2];
+        s3 += data1[i + 3] * data2[i + 3];
+    }
+    for (; i < size; ++i) {
+        s0 += data1[i] * data2[i];
+    }
+    return (s0 + s1) + (s2 + s3);
+}
+
+static size_t fscl_data_compact_scalar(double *data, size_t size, double low, double high) {
+    size_t j = 0;
+    for (size_t i = 0; i < size; ++i) {
+        double value = data[i];
+        data[j] = value;
+        j += (value >= low) & (value <= high);
+    }
+    return j;
+}
+
+static void fscl_data_stats_lanes_scalar(const double *const *data, const size_t *sizes, size_t lanes, cdataset_stats **out) {
+    size_t count[FSCL_DATA_BATCH_LANES] = {0};
+    double sum[FSCL_DATA_BATCH_LANES], min_val[FSCL_DATA_BATCH_LANES], max_val[FSCL_DATA_BATCH_LANES];
+    size_t common = 0;
+
+    // Interleave the shared prefix so the lanes are independent chains
+    if (lanes == FSCL_DATA_BATCH_LANES) {
+        common = sizes[0];
+        for (size_t k = 1; k < lanes; ++k) {
+            if (sizes[k] < common) common = sizes[k];
+        }
+    }
+    for (size_t k = 0; k < FSCL_DATA_BATCH_LANES; ++k) {
+        sum[k] = 0.0;
+        min_val[k] = INFINITY;
+        max_val[k] = -INFINITY;
+    }
+    for (size_t i = 0; i < common; ++i) {
+        for (size_t k = 0; k < FSCL_DATA_BATCH_LANES; ++k) {
+            fscl_data_lane_sums(data[k], i, i + 1, &count[k], &sum[k], &min_val[k], &max_val[k]);
+        }
+    }
+
+    for (size_t k = 0; k < lanes; ++k) {
+        fscl_data_lane_sums(data[k], common, sizes[k], &count[k], &sum[k], &min_val[k], &max_val[k]);
+        double mean = count[k] > 0 ? sum[k] / (double)count[k] : 0.0;
+        double m2 = fscl_data_lane_m2(data[k], 0, sizes[k], mean);
+        fscl_data_lane_store(out[k], sizes[k], count[k], sum[k], m2, min_val[k], max_val[k]);
+    }
+}
+
+static const cdataset_kernels fscl_data_kernels_scalar = {
+    FSCL_DATA_SIMD_SCALAR,
+    fscl_data_sum_scalar, fscl_data_min_scalar,
+    fscl_data_max_scalar, fscl_data_dot_scalar,
+    fscl_data_compact_scalar, fscl_data_stats_lanes_scalar
+};
+
+#ifdef FSCL_DATA_X86
+
+// SSE2: 4 x 2 lanes per iteration.
+
+FSCL_DATA_TARGET("sse2")
+static double fscl_data_sum_sse2(const double *data, size_t size) {
+    __m128d a0 = _mm_setzero_pd(), a1 = _mm_setzero_pd();
+    __m128d a2 = _mm_setzero_pd(), a3 = _mm_setzero_pd();
+    double lanes[2];
+    size_t i = 0;
+    for (; i + 8 <= size; i += 8) {
+        a0 = _mm_add_pd(a0, _mm_loadu_pd(data + i));
+        a1 = _mm_add_pd(a1, _mm_loadu_pd(data + i + 2));
+        a2 = _mm_add_pd(a2, _mm_loadu_pd(data + i + 4));
+        a3 = _mm_add_pd(a3, _mm_loadu_pd(data + i + 6));
+    }
+    _mm_storeu_pd(lanes, _mm_add_pd(_mm_add_pd(a0, a1), _mm_add_pd(a2, a3)));
+    double sum = lanes[0] + lanes[1];
+    for (; i < size; ++i) {
+        sum += data[i];
+    }
+    return sum;
+}
+
+FSCL_DATA_TARGET("sse2")
+static double fscl_data_min_sse2(const double *data, size_t size) {
+    __m128d a0 = _mm_set1_pd(data[0]), a1 = a0, a2 = a0, a3 = a0;
+    double lanes[2];
+    size_t i = 0;
+    for (; i + 8 <= size; i += 8) {
+        a0 = _mm_min_pd(_mm_loadu_pd(data + i), a0);
+        a1 = _mm_min_pd(_mm_loadu_pd(data + i + 2), a1);
+        a2 = _mm_min_pd(_mm_loadu_pd(data + i + 4), a2);
+        a3 = _mm_min_pd(_mm_loadu_pd(data + i + 6), a3);
+    }
+    _mm_storeu_pd(lanes, _mm_min_pd(_mm_min_pd(a1, a0), _mm_min_pd(a3, a2)));
+    double min_val = lanes[0];
+    if (lanes[1] < min_val) min_val = lanes[1];
+    for (; i < size; ++i) {
+        if (data[i] < min_val) min_val = data[i];
+    }
+    return min_val;
+}
+
+FSCL_DATA_TARGET("sse2")
+static double fscl_data_max_sse2(const double *data, size_t size) {
+    __m128d a0 = _mm_set1_pd(data[0]), a1 = a0, a2 = a0, a3 = a0;
+    double lanes[2];
+    size_t i = 0;
+    for (; i + 8 <= size; i += 8) {
+        a0 = _mm_max_pd(_mm_loadu_pd(data + i), a0);
+        a1 = _mm_max_pd(_mm_loadu_pd(data + i + 2), a1);
+        a2 = _mm_max_pd(_mm_loadu_pd(data + i + 4), a2);
+        a3 = _mm_max_pd(_mm_loadu_pd(data + i + 6), a3);
+    }
+    _mm_storeu_pd(lanes, _mm_max_pd(_mm_max_pd(a1, a0), _mm_max_pd(a3, a2)));
+    double max_val = lanes[0];
+    if (lanes[1] > max_val) max_val = lanes[1];
+    for (; i < size; ++i) {
+        if (data[i] > max_val) max_val = data[i];
+    }
+    return max_val;
+}
+
+FSCL_DATA_TARGET("sse2")
+static double fscl_data_dot_sse2(const double *data1, const double *data2, size_t size) {
+    __m128d a0 = _mm_setzero_pd(), a1 = _mm_setzero_pd();
+    __m128d a2 = _mm_setzero_pd(), a3 = _mm_setzero_pd();
+    double lanes[2];
+    size_t i = 0;
+    for (; i + 8 <= size; i += 8) {
+        a0 = _mm_add_pd(a0, _mm_mul_pd(_mm_loadu_pd(data1 + i), _mm_loadu_pd(data2 + i)));
+        a1 = _mm_add_pd(a1, _mm_mul_pd(_mm_loadu_pd(data1 + i + 2), _mm_loadu_pd(data2 + i + 2)));
+        a2 = _mm_add_pd(a2, _mm_mul_pd(_mm_loadu_pd(data1 + i + 4), _mm_loadu_pd(data2 + i + 4)));
+        a3 = _mm_add_pd(a3, _mm_mul_pd(_mm_loadu_pd(data1 + i + 6), _mm_loadu_pd(data2 + i + 6)));
+    }
+    _mm_storeu_pd(lanes, _mm_add_pd(_mm_add_pd(a0, a1), _mm_add_pd(a2, a3)));
+    double dot = lanes[0] + lanes[1];
+    for (; i < size; ++i) {
+        dot += data1[i] * data2[i];
+    }
+    return dot;
+}
+
+// Two lanes leave nothing for a shuffle table to win; SSE2 compacts with
+// the branchless scalar loop.
+static const cdataset_kernels fscl_data_kernels_sse2 = {
+    FSCL_DATA_SIMD_SSE2,
+    fscl_data_sum_sse2, fscl_data_min_sse2,
+    fscl_data_max_sse2, fscl_data_dot_sse2,
+    fscl_data_compact_scalar, fscl_data_stats_lanes_scalar
+};
+
+// AVX2 + FMA: 4 x 4 lanes per iteration.
+
+FSCL_DATA_TARGET("avx2,fma")
+static double fscl_data_sum_avx2(const double *data, size_t size) {
+    __m256d a0 = _mm256_setzero_pd(), a1 = _mm256_setzero_pd();
+    __m256d a2 = _mm256_setzero_pd(), a3 = _mm256_setzero_pd();
+    double lanes[4];
+    size_t i = 0;
+    for (; i + 16 <= size; i += 16) {
+        a0 = _mm256_add_pd(a0, _mm256_loadu_pd(data + i));
+        a1 = _mm256_add_pd(a1, _mm256_loadu_pd(data + i + 4));
+        a2 = _mm256_add_pd(a2, _mm256_loadu_pd(data + i + 8));
+        a3 = _mm256_add_pd(a3, _mm256_loadu_pd(data + i + 12));
+    }
+    _mm256_storeu_pd(lanes, _mm256_add_pd(_mm256_add_pd(a0, a1), _mm256_add_pd(a2, a3)));
+    double sum = (lanes[0] + lanes[1]) + (lanes[2] + lanes[3]);
+    for (; i < size; ++i) {
+        sum += data[i];
+    }
+    return sum;
+}
+
+FSCL_DATA_TARGET("avx2,fma")
+static double fscl_data_min_avx2(const double *data, size_t size) {
+    __m256d a0 = _mm256_set1_pd(data[0]), a1 = a0, a2 = a0, a3 = a0;
+    double lanes[4];
+    size_t i = 0;
+    for (; i + 16 <= size; i += 16) {
+        a0 = _mm256_min_pd(_mm256_loadu_pd(data + i), a0);
+        a1 = _mm256_min_pd(_mm256_loadu_pd(data + i + 4), a1);
+        a2 = _mm256_min_pd(_mm256_loadu_pd(data + i + 8), a2);
+        a3 = _mm256_min_pd(_mm256_loadu_pd(data + i + 12), a3);
+    }
+    _mm256_storeu_pd(lanes, _mm256_min_pd(_mm256_min_pd(a1, a0), _mm256_min_pd(a3, a2)));
+    double min_val = lanes[0];
+    for (size_t k = 1; k < 4; ++k) {
+        if (lanes[k] < min_val) min_val = lanes[k];
+    }
+    for (; i < size; ++i) {
+        if (data[i] < min_val) min_val = data[i];
+    }
+    return min_val;
+}
+
+FSCL_DATA_TARGET("avx2,fma")
+static double fscl_data_max_avx2(const double *data, size_t size) {
+    __m256d a0 = _mm256_set1_pd(data[0]), a1 = a0, a2 = a0, a3 = a0;
+    double lanes[4];
+    size_t i = 0;
+    for (; i + 16 <= size; i += 16) {
+        a0 = _mm256_max_pd(_mm256_loadu_pd(data + i), a0);
+        a1 = _mm256_max_pd(_mm256_loadu_pd(data + i + 4), a1);
+        a2 = _mm256_max_pd(_mm256_loadu_pd(data + i + 8), a2);
+        a3 = _mm256_max_pd(_mm256_loadu_pd(data + i + 12), a3);
+    }
+    _mm256_storeu_pd(lanes, _mm256_max_pd(_mm256_max_pd(a1, a0), _mm256_max_pd(a3, a2)));
+    double max_val = lanes[0];
+    for (size_t k = 1; k < 4; ++k) {
+        if (lanes[k] > max_val) max_val = lanes[k];
+    }
+    for (; i < size; ++i) {
+        if (data[i] > max_val) max_val = data[i];
+    }
+    return max_val;
+}
+
+FSCL_DATA_TARGET("avx2,fma")
+static double fscl_data_dot_avx2(const double *data1, const double *data2, size_t size) {
+    __m256d a0 = _mm256_setzero_pd(), a1 = _mm256_setzero_pd();
+    __m256d a2 = _mm256_setzero_pd(), a3 = _mm256_setzero_pd();
+    double lanes[4];
+    size_t i = 0;
+    for (; i + 16 <= size; i += 16) {
+        a0 = _mm256_fmadd_pd(_mm256_loadu_pd(data1 + i), _mm256_loadu_pd(data2 + i), a0);
+        a1 = _mm256_fmadd_pd(_mm256_loadu_pd(data1 + i + 4), _mm256_loadu_pd(data2 + i + 4), a1);
+        a2 = _mm256_fmadd_pd(_mm256_loadu_pd(data1 + i + 8), _mm256_loadu_pd(data2 + i + 8), a2);
+        a3 = _mm256_fmadd_pd(_mm256_loadu_pd(data1 + i + 12), _mm256_loadu_pd(data2 + i + 12), a3);
+    }
+    _mm256_storeu_pd(lanes, _mm256_add_pd(_mm256_add_pd(a0, a1), _mm256_add_pd(a2, a3)));
+    double dot = (lanes[0] + lanes[1]) + (lanes[2] + lanes[3]);
+    for (; i < size; ++i) {
+        dot += data1[i] * data2[i];
+    }
+    return dot;
+}
+
+// Number of kept lanes for each 4-bit keep mask
+static const unsigned char fscl_data_compact_count[16] = {0, 1, 1, 2, 1, 2, 2, 3, 1, 2, 2, 3, 2, 3, 3, 4};
+
+// 32-bit lane permutation packing the kept doubles of each keep mask
+static const int32_t fscl_data_compact_permute[16][8] = {
+    {0, 1, 0, 1, 0, 1, 0, 1}, {0, 1, 0, 1, 0, 1, 0, 1},
+    {2, 3, 2, 3, 2, 3, 2, 3}, {0, 1, 2, 3, 2, 3, 2, 3},
+    {4, 5, 4, 5, 4, 5, 4, 5}, {0, 1, 4, 5, 4, 5, 4, 5},
+    {2, 3, 4, 5, 4, 5, 4, 5}, {0, 1, 2, 3, 4, 5, 4, 5},
+    {6, 7, 6, 7, 6, 7, 6, 7}, {0, 1, 6, 7, 6, 7, 6, 7},
+    {2, 3, 6, 7, 6, 7, 6, 7}, {0, 1, 2, 3, 6, 7, 6, 7},
+    {4, 5, 6, 7, 6, 7, 6, 7}, {0, 1, 4, 5, 6, 7, 6, 7},
+    {2, 3, 4, 5, 6, 7, 6, 7}, {0, 1, 2, 3, 4, 5, 6, 7}
+};
+
+FSCL_DATA_TARGET("avx2,fma")
+static size_t fscl_data_compact_avx2(double *data, size_t size, double low, double high) {
+    __m256d lo = _mm256_set1_pd(low), hi = _mm256_set1_pd(high);
+    size_t i = 0, j = 0;
+    for (; i + 4 <= size; i += 4) {
+        __m256d v = _mm256_loadu_pd(data + i);
+        int mask = _mm256_movemask_pd(_mm256_and_pd(_mm256_cmp_pd(v, lo, _CMP_GE_OQ), _mm256_cmp_pd(v, hi, _CMP_LE_OQ)));
+        __m256i permute = _mm256_loadu_si256((const __m256i *)fscl_data_compact_permute[mask]);
+        _mm256_storeu_pd(data + j, _mm256_castps_pd(_mm256_permutevar8x32_ps(_mm256_castpd_ps(v), permute)));
+        j += fscl_data_compact_count[mask];
+    }
+    for (; i < size; ++i) {
+        double value = data[i];
+        data[j] = value;
+        j += (value >= low) & (value <= high);
+    }
+    return j;
+}
+
+// One vector of four consecutive elements per series and step; the lanes
+// of each vector are reduced only when the series is done.
+FSCL_DATA_TARGET("avx2,fma")
+static void fscl_data_stats_lanes_avx2(const double *const *data, const size_t *sizes, size_t lanes, cdataset_stats **out) {
+    if (lanes < FSCL_DATA_BATCH_LANES) {
+        fscl_data_stats_lanes_scalar(data, sizes, lanes, out);
+        return;
+    }
+
+    size_t common = sizes[0];
+    for (size_t k = 1; k < FSCL_DATA_BATCH_LANES; ++k) {
+        if (sizes[k] < common) common = sizes[k];
+    }
+    common &= ~(size_t)3;
+
+    __m256d sum[FSCL_DATA_BATCH_LANES], lo[FSCL_DATA_BATCH_LANES], hi[FSCL_DATA_BATCH_LANES];
+    __m256i present[FSCL_DATA_BATCH_LANES];
+    for (size_t k = 0; k < FSCL_DATA_BATCH_LANES; ++k) {
+        sum[k] = _mm256_setzero_pd();
+        lo[k] = _mm256_set1_pd(INFINITY);
+        hi[k] = _mm256_set1_pd(-INFINITY);
+        present[k] = _mm256_setzero_si256();
+    }
+    for (size_t i = 0; i < common; i += 4) {
+        for (size_t k = 0; k < FSCL_DATA_BATCH_LANES; ++k) {
+            __m256d v = _mm256_loadu_pd(data[k] + i);
+            __m256d ordered = _mm256_cmp_pd(v, v, _CMP_ORD_Q);
+            sum[k] = _mm256_add_pd(sum[k], _mm256_and_pd(v, ordered));
+            present[k] = _mm256_sub_epi64(present[k], _mm256_castpd_si256(ordered));
+            lo[k] = _mm256_min_pd(v, lo[k]);  // keeps lo when v is NaN
+            hi[k] = _mm256_max_pd(v, hi[k]);
+        }
+    }
+
+    double mean[FSCL_DATA_BATCH_LANES];
+    size_t count[FSCL_DATA_BATCH_LANES];
+    double total[FSCL_DATA_BATCH_LANES], min_val[FSCL_DATA_BATCH_LANES], max_val[FSCL_DATA_BATCH_LANES];
+    __m256d m2[FSCL_DATA_BATCH_LANES], centre[FSCL_DATA_BATCH_LANES];
+    for (size_t k = 0; k < FSCL_DATA_BATCH_LANES; ++k) {
+        double s[4], l[4], h[4];
+        int64_t c[4];
+        _mm256_storeu_pd(s, sum[k]);
+        _mm256_storeu_pd(l, lo[k]);
+        _mm256_storeu_pd(h, hi[k]);
+        _mm256_storeu_si256((__m256i *)c, present[k]);
+        total[k] = (s[0] + s[1]) + (s[2] + s[3]);
+        count[k] = (size_t)(c[0] + c[1] + c[2] + c[3]);
+        min_val[k] = l[0];
+        max_val[k] = h[0];
+        for (size_t j = 1; j < 4; ++j) {
+            if (l[j] < min_val[k]) min_val[k] = l[j];
+            if (h[j] > max_val[k]) max_val[k] = h[j];
+        }
+        fscl_data_lane_sums(data[k], common, sizes[k], &count[k], &total[k], &min_val[k], &max_val[k]);
+        mean[k] = count[k] > 0 ? total[k] / (double)count[k] : 0.0;
+        centre[k] = _mm256_set1_pd(mean[k]);
+        m2[k] = _mm256_setzero_pd();
+    }
+
+    for (size_t i = 0; i < common; i += 4) {
+        for (size_t k = 0; k < FSCL_DATA_BATCH_LANES; ++k) {
+            __m256d diff = _mm256_sub_pd(_mm256_loadu_pd(data[k] + i), centre[k]);
+            diff = _mm256_and_pd(diff, _mm256_cmp_pd(diff, diff, _CMP_ORD_Q));
+            m2[k] = _mm256_fmadd_pd(diff, diff, m2[k]);
+        }
+    }
+    for (size_t k = 0; k < FSCL_DATA_BATCH_LANES; ++k) {
+        double d[4];
+        _mm256_storeu_pd(d, m2[k]);
+        double deviation = (d[0] + d[1]) + (d[2] + d[3]) + fscl_data_lane_m2(data[k], common, sizes[k], mean[k]);
+        fscl_data_lane_store(out[k], sizes[k], count[k], total[k], deviation, min_val[k], max_val[k]);
+    }
+}
+
+static const cdataset_kernels fscl_data_kernels_avx2 = {
+    FSCL_DATA_SIMD_AVX2,
+    fscl_data_sum_avx2, fscl_data_min_avx2,
+    fscl_data_max_avx2, fscl_data_dot_avx2,
+    fscl_data_compact_avx2, fscl_data_stats_lanes_avx2
+};
+
+// AVX-512F: 4 x 8 lanes per iteration.
+
+FSCL_DATA_TARGET("avx512f")
+static double fscl_data_sum_avx512(const double *data, size_t size) {
+    __m512d a0 = _mm512_setzero_pd(), a1 = _mm512_setzero_pd();
+    __m512d a2 = _mm512_setzero_pd(), a3 = _mm512_setzero_pd();
+    double lanes[8];
+    size_t i = 0;
+    for (; i + 32 <= size; i += 32) {
+        a0 = _mm512_add_pd(a0, _mm512_loadu_pd(data + i));
+        a1 = _mm512_add_pd(a1, _mm512_loadu_pd(data + i + 8));
+        a2 = _mm512_add_pd(a2, _mm512_loadu_pd(data + i + 16));
+        a3 = _mm512_add_pd(a3, _mm512_loadu_pd(data + i + 24));
+    }
+    _mm512_storeu_pd(lanes, _mm512_add_pd(_mm512_add_pd(a0, a1), _mm512_add_pd(a2, a3)));
+    double sum = ((lanes[0] + lanes[1]) + (lanes[2] + lanes[3])) + ((lanes[4] + lanes[5]) + (lanes[6] + lanes[7]));
+    for (; i < size; ++i) {
+        sum += data[i];
+    }
+    return sum;
+}
+
+FSCL_DATA_TARGET("avx512f")
+static double fscl_data_min_avx512(const double *data, size_t size) {
+    __m512d a0 = _mm512_set1_pd(data[0]), a1 = a0, a2 = a0, a3 = a0;
+    double lanes[8];
+    size_t i = 0;
+    for (; i + 32 <= size; i += 32) {
+        a0 = _mm512_min_pd(_mm512_loadu_pd(data + i), a0);
+        a1 = _mm512_min_pd(_mm512_loadu_pd(data + i + 8), a1);
+        a2 = _mm512_min_pd(_mm512_loadu_pd(data + i + 16), a2);
+        a3 = _mm512_min_pd(_mm512_loadu_pd(data + i + 24), a3);
+    }
+    _mm512_storeu_pd(lanes, _mm512_min_pd(_mm512_min_pd(a1, a0), _mm512_min_pd(a3, a2)));
+    double min_val = lanes[0];
+    for (size_t k = 1; k < 8; ++k) {
+        if (lanes[k] < min_val) min_val = lanes[k];
+    }
+    for (; i < size; ++i) {
+        if (data[i] < min_val) min_val = data[i];
+    }
+    return min_val;
+}
+
+FSCL_DATA_TARGET("avx512f")
+static double fscl_data_max_avx512(const double *data, size_t size) {
+    __m512d a0 = _mm512_set1_pd(data[0]), a1 = a0, a2 = a0, a3 = a0;
+    double lanes[8];
+    size_t i = 0;
+    for (; i + 32 <= size; i += 32) {
+        a0 = _mm512_max_pd(_mm512_loadu_pd(data + i), a0);
+        a1 = _mm512_max_pd(_mm512_loadu_pd(data + i + 8), a1);
+        a2 = _mm512_max_pd(_mm512_loadu_pd(data + i + 16), a2);
+        a3 = _mm512_max_pd(_mm512_loadu_pd(data + i + 24), a3);
+    }
+    _mm512_storeu_pd(lanes, _mm512_max_pd(_mm512_max_pd(a1, a0), _mm512_max_pd(a3, a2)));
+    double max_val = lanes[0];
+    for (size_t k = 1; k < 8; ++k) {
+        if (lanes[k] > max_val) max_val = lanes[k];
+    }
+    for (; i < size; ++i) {
+        if (data[i] > max_val) max_val = data[i];
+    }
+    return max_val;
+}
+
+FSCL_DATA_TARGET("avx512f")
+static double fscl_data_dot_avx512(const double *data1, const double *data2, size_t size) {
+    __m512d a0 = _mm512_setzero_pd(), a1 = _mm512_setzero_pd();
+    __m512d a2 = _mm512_setzero_pd(), a3 = _mm512_setzero_pd();
+    double lanes[8];
+    size_t i = 0;
+    for (; i + 32 <= size; i += 32) {
+        a0 = _mm512_fmadd_pd(_mm512_loadu_pd(data1 + i), _mm512_loadu_pd(data2 + i), a0);
+        a1 = _mm512_fmadd_pd(_mm512_loadu_pd(data1 + i + 8), _mm512_loadu_pd(data2 + i + 8), a1);
+        a2 = _mm512_fmadd_pd(_mm512_loadu_pd(data1 + i + 16), _mm512_loadu_pd(data2 + i + 16), a2);
+        a3 = _mm512_fmadd_pd(_mm512_loadu_pd(data1 + i + 24), _mm512_loadu_pd(data2 + i + 24), a3);
+    }
+    _mm512_storeu_pd(lanes, _mm512_add_pd(_mm512_add_pd(a0, a1), _mm512_add_pd(a2, a3)));
+    double dot = ((lanes[0] + lanes[1]) + (lanes[2] + lanes[3])) + ((lanes[4] + lanes[5]) + (lanes[6] + lanes[7]));
+    for (; i < size; ++i) {
+        dot += data1[i] * data2[i];
+    }
+    return dot;
+}
+
+FSCL_DATA_TARGET("avx512f")
+static size_t fscl_data_compact_avx512(double *data, size_t size, double low, double high) {
+    __m512d lo = _mm512_set1_pd(low), hi = _mm512_set1_pd(high);
+    size_t i = 0, j = 0;
+    for (; i + 8 <= size; i += 8) {
+        __m512d v = _mm512_loadu_pd(data + i);
+        __mmask8 mask = _mm512_mask_cmp_pd_mask(_mm512_cmp_pd_mask(v, lo, _CMP_GE_OQ), v, hi, _CMP_LE_OQ);
+        _mm512_mask_compressstoreu_pd(data + j, mask, v);
+        j += fscl_data_compact_count[mask & 15] + fscl_data_compact_count[mask >> 4];
+    }
+    for (; i < size; ++i) {
+        double value = data[i];
+        data[j] = value;
+        j += (value >= low) & (value <= high);
+    }
+    return j;
+}
+
+static const cdataset_kernels fscl_data_kernels_avx512 = {
+    FSCL_DATA_SIMD_AVX512,
+    fscl_data_sum_avx512, fscl_data_min_avx512,
+    fscl_data_max_avx512, fscl_data_dot_avx512,
+    fscl_data_compact_avx512, fscl_data_stats_lanes_avx2
+};
+
+#endif // FSCL_DATA_X86
+
+// Function to query the widest instruction set usable on this CPU
+static cdataset_simd fscl_data_detect_simd(void) {
+#if defined(FSCL_DATA_X86) && defined(_MSC_VER) && !defined(__clang__)
+    int info[4];
+    __cpuid(info, 0);
+    int max_leaf = info[0];
+    __cpuid(info, 1);
+    int has_sse2 = (info[3] >> 26) & 1;
+    int has_fma = (info[2] >> 12) & 1;
+    int has_avx = (info[2] >> 28) & 1;
+    unsigned long long xcr0 = ((info[2] >> 27) & 1) ? _xgetbv(0) : 0;
+    int has_avx2 = 0, has_avx512 = 0;
+    if (max_leaf >= 7) {
+        __cpuidex(info, 7, 0);
+        has_avx2 = (info[1] >> 5) & 1;
+        has_avx512 = (info[1] >> 16) & 1;
+    }
+    if (has_avx512 && (xcr0 & 0xE6) == 0xE6) {
+        return FSCL_DATA_SIMD_AVX512;
+    }
+    if (has_avx && has_avx2 && has_fma && (xcr0 & 0x6) == 0x6) {
+        return FSCL_DATA_SIMD_AVX2;
+    }
+    if (has_sse2) {
+        return FSCL_DATA_SIMD_SSE2;
+    }
+#elif defined(FSCL_DATA_X86)
+    // The builtins also verify that the OS saves the wider register state
+    __builtin_cpu_init();
+    if (__builtin_cpu_supports("avx512f")) {
+        return FSCL_DATA_SIMD_AVX512;
+    }
+    if (__builtin_cpu_supports("avx2") && __builtin_cpu_supports("fma")) {
+        return FSCL_DATA_SIMD_AVX2;
+    }
+    if (__builtin_cpu_supports("sse2")) {
+        return FSCL_DATA_SIMD_SSE2;
+    }
+#endif
+    return FSCL_DATA_SIMD_SCALAR;
+}
+
+static const cdataset_kernels *fscl_data_active_kernels = NULL;
+
+// Function to fetch the kernel table, selecting it on first use
+static const cdataset_kernels *fscl_data_kernels(void) {
+    const cdataset_kernels *kernels = fscl_data_active_kernels;
+    if (kernels != NULL) {
+        return kernels;
+    }
+
+    kernels = &fscl_data_kernels_scalar;
+#ifdef FSCL_DATA_X86
+    switch (fscl_data_detect_simd()) {
+        case FSCL_DATA_SIMD_AVX512: kernels = &fscl_data_kernels_avx512; break;
+        case FSCL_DATA_SIMD_AVX2:   kernels = &fscl_data_kernels_avx2;   break;
+        case FSCL_DATA_SIMD_SSE2:   kernels = &fscl_data_kernels_sse2;   break;
+        default: break;
+    }
+#endif
+    fscl_data_active_kernels = kernels;
+    return kernels;
+}
+
+#if defined(__GNUC__) || defined(__clang__)
+// Resolve the kernels at load time so threads never race on the first call
+__attribute__((constructor)) static void fscl_data_init_kernels(void) {
+    (void)fscl_data_kernels();
+}
+#endif
+
+// Function to report which kernel family is in use
+cdataset_simd fscl_data_simd_level(void) {
+    return fscl_data_kernels()->level;
+}
+
+// =================================================================
+// Execution policy
+// =================================================================
+
+// Elements handed to one thread at a time (128 KiB, sized for L2)
+#define FSCL_DATA_CHUNK 16384
+
+static cdataset_exec fscl_data_exec = FSCL_DATA_EXEC_DEFAULT;
+
+// Function to decide whether a call runs on the thread pool
+int fscl_data_parallel(cdataset_exec policy) {
+    if (policy == FSCL_DATA_EXEC_DEFAULT) {
+        policy = fscl_data_exec;
+    }
+    if (policy == FSCL_DATA_EXEC_SERIAL) {
+        return 0;
+    }
+    if (policy == FSCL_DATA_EXEC_PARALLEL && fscl_parallel_get_threads() <= 1) {
+        fscl_parallel_set_threads(0);
+    }
+    return fscl_parallel_get_threads() > 1;
+}
+
+// Function to run a chunked task serially or on the pool
+void fscl_data_for(cdataset_exec policy, size_t count, size_t grain, cparallel_task task, void *context) {
+    if (grain == 0) {
+        grain = 1;
+    }
+    if (fscl_data_parallel(policy)) {
+        fscl_parallel_for(count, grain, task, context);
+        return;
+    }
+    for (size_t begin = 0; begin < count; begin += grain) {
+        size_t end = count - begin > grain ? begin + grain : count;
+        task(context, begin, end);
+    }
+}
+
+// Function to set the execution policy used by FSCL_DATA_EXEC_DEFAULT
+void fscl_data_set_exec(cdataset_exec policy) {
+    if (policy == FSCL_DATA_EXEC_PARALLEL && fscl_parallel_get_threads() <= 1) {
+        fscl_parallel_set_threads(0);
+    }
+    fscl_data_exec = policy;
+}
+
+// Function to get the global execution policy
+cdataset_exec fscl_data_get_exec(void) {
+    return fscl_data_exec;
+}
+
+// Recomputes the zone map, if any, after a mutator wrote the data
+static void fscl_data_zones_refresh(cdataset *dataset);
+
+// Operands of an element-wise operation
+typedef struct {
+    const double *data1;
+    const double *data2;
+    double *result;
+    double factor;
+} cdataset_elementwise;
+
+static void fscl_data_add_chunk(void *context, size_t begin, size_t end) {
+    cdataset_elementwise *op = (cdataset_elementwise *)context;
+    for (size_t i = begin; i < end; ++i) {
+        op->result[i] = op->data1[i] + op->data2[i];
+    }
+}
+
+static void fscl_data_subtract_chunk(void *context, size_t begin, size_t end) {
+    cdataset_elementwise *op = (cdataset_elementwise *)context;
+    for (size_t i = begin; i < end; ++i) {
+        op->result[i] = op->data1[i] - op->data2[i];
+    }
+}
+
+static void fscl_data_multiply_chunk(void *context, size_t begin, size_t end) {
+    cdataset_elementwise *op = (cdataset_elementwise *)context;
+    for (size_t i = begin; i < end; ++i) {
+        op->result[i] = op->data1[i] * op->data2[i];
+    }
+}
+
+static void fscl_data_scale_chunk(void *context, size_t begin, size_t end) {
+    cdataset_elementwise *op = (cdataset_elementwise *)context;
+    for (size_t i = begin; i < end; ++i) {
+        op->result[i] *= op->factor;
+    }
+}
+
+static void fscl_data_zero_chunk(void *context, size_t begin, size_t end) {
+    cdataset_elementwise *op = (cdataset_elementwise *)context;
+    memset(op->result + begin, 0, (end - begin) * sizeof(double));
+}
+
+// Function to run a binary element-wise operation after checking sizes
+static void fscl_data_binary(const cdataset *dataset1, const cdataset *dataset2, cdataset *result,
+                             cdataset_exec policy, cparallel_task task) {
+    if (dataset1->size != dataset2->size || result->size != dataset1->size) {
+        // Handle error: sizes must match
+        return;
+    }
+
+    fscl_data_index_drop(result);
+    cdataset_elementwise op = {dataset1->data, dataset2->data, result->data, 0.0};
+    fscl_data_for(policy, result->size, FSCL_DATA_CHUNK, task, &op);
+    fscl_data_zones_refresh(result);
+}
+
+// Reductions that can be split into per-chunk partial results
+typedef enum {
+    FSCL_DATA_REDUCE_SUM,
+    FSCL_DATA_REDUCE_MIN,
+    FSCL_DATA_REDUCE_MAX,
+    FSCL_DATA_REDUCE_DOT
+} cdataset_reduce;
+
+// Operands and per-chunk results of a chunked reduction
+typedef struct {
+    const double *data1;
+    const double *data2;
+    cdataset_reduce kind;
+    double *partial;
+    cdataset_stats *stats;
+} cdataset_reduction;
+
+// Function to reduce one range. Min/max kernels only skip NaN after the
+// first element, so ranges other than the first skip leading NaNs here;
+// this keeps the result identical to one kernel call over all the data.
+static double fscl_data_reduce_range(const cdataset_reduction *job, size_t begin, size_t end) {
+    const cdataset_kernels *kernels = fscl_data_kernels();
+    const double *data = job->data1 + begin;
+    size_t size = end - begin;
+
+    switch (job->kind) {
+        case FSCL_DATA_REDUCE_SUM:
+            return kernels->sum(data, size);
+        case FSCL_DATA_REDUCE_DOT:
+            return kernels->dot(data, job->data2 + begin, size);
+        default:
+            break;
+    }
+
+    if (begin > 0) {
+        while (size > 0 && isnan(*data)) {
+            ++data;
+            --size;
+        }
+        if (size == 0) {
+            return NAN;
+        }
+    }
+    return job->kind == FSCL_DATA_REDUCE_MIN ? kernels->min(data, size) : kernels->max(data, size);
+}
+
+// Function to fold the result of a later chunk into the running result
+static double fscl_data_reduce_combine(cdataset_reduce kind, double result, double part) {
+    switch (kind) {
+        case FSCL_DATA_REDUCE_MIN:
+            return part < result ? part : result;
+        case FSCL_DATA_REDUCE_MAX:
+            return part > result ? part : result;
+        default:
+            return result + part;
+    }
+}
+
+static void fscl_data_reduce_chunk(void *context, size_t begin, size_t end) {
+    cdataset_reduction *job = (cdataset_reduction *)context;
+    job->partial[begin / FSCL_DATA_CHUNK] = fscl_data_reduce_range(job, begin, end);
+}
+
+// Function to run a reduction chunk by chunk, on the pool when enabled.
+// Partial results are combined in chunk order on both paths, so the
+// result does not depend on the number of threads.
+static double fscl_data_reduce(cdataset_reduction *job, size_t size) {
+    size_t chunks = (size + FSCL_DATA_CHUNK - 1) / FSCL_DATA_CHUNK;
+    double result;
+
+    if (chunks <= 1) {
+        return fscl_data_reduce_range(job, 0, size);
+    }
+
+    if (fscl_data_parallel(FSCL_DATA_EXEC_DEFAULT)) {
+        job->partial = (double *)malloc(chunks * sizeof(double));
+    }
+    if (job->partial != NULL) {
+        fscl_data_for(FSCL_DATA_EXEC_DEFAULT, size, FSCL_DATA_CHUNK, fscl_data_reduce_chunk, job);
+        result = job->partial[0];
+        for (size_t c = 1; c < chunks; ++c) {
+            result = fscl_data_reduce_combine(job->kind, result, job->partial[c]);
+        }
+        free(job->partial);
+        job->partial = NULL;
+        return result;
+    }
+
+    result = fscl_data_reduce_range(job, 0, FSCL_DATA_CHUNK);
+    for (size_t begin = FSCL_DATA_CHUNK; begin < size; begin += FSCL_DATA_CHUNK) {
+        size_t end = size - begin > FSCL_DATA_CHUNK ? begin + FSCL_DATA_CHUNK : size;
+        result = fscl_data_reduce_combine(job->kind, result, fscl_data_reduce_range(job, begin, end));
+    }
+    return result;
+}
+
+// =================================================================
+// Library-owned extras
+// =================================================================
+//
+// Everything the library attaches to a dataset lives behind one `ext`
+// pointer, allocated on first use and freed once nothing is attached, so
+// a view over caller memory stays {data, size, NULL}.
+
+typedef struct {
+    void *storage;                  // owner of data when not from malloc
+    void (*release)(void *storage);
+    void *index;                    // cdataset_index, NULL if none
+    void *zones;                    // cdataset_zones, NULL if none
+} cdataset_ext;
+
+// Function to get the extras of a dataset, allocating them on first use
+static cdataset_ext *fscl_data_ext_open(cdataset *dataset) {
+    if (dataset->ext == NULL) {
+        dataset->ext = calloc(1, sizeof(cdataset_ext));
+    }
+    return (cdataset_ext *)dataset->ext;
+}
+
+// Function to free the extras of a dataset once nothing is attached
+static void fscl_data_ext_close(cdataset *dataset) {
+    cdataset_ext *ext = (cdataset_ext *)dataset->ext;
+    if (ext != NULL && ext->storage == NULL && ext->index == NULL && ext->zones == NULL) {
+        free(ext);
+        dataset->ext = NULL;
+    }
+}
+
+// Function to hand the buffer of a dataset to another owner
+int fscl_data_storage_attach(cdataset *dataset, void *storage, void (*release)(void *storage)) {
+    cdataset_ext *ext = fscl_data_ext_open(dataset);
+    if (ext == NULL) {
+        fprintf(stderr, "Error: Memory allocation failed for dataset storage.\n");
+        return -1;
+    }
+    ext->storage = storage;
+    ext->release = release;
+    return 0;
+}
+
+// Function to get the owner of the buffer of a dataset
+void *fscl_data_storage_get(const cdataset *dataset) {
+    const cdataset_ext *ext = (const cdataset_ext *)dataset->ext;
+    return ext != NULL ? ext->storage : NULL;
+}
+
+// Function to get the attached lookup index, NULL if none
+static void *fscl_data_ext_index(const cdataset *dataset) {
+    const cdataset_ext *ext = (const cdataset_ext *)dataset->ext;
+    return ext != NULL ? ext->index : NULL;
+}
+
+// Function to get the attached zone map, NULL if none
+static void *fscl_data_ext_zones(const cdataset *dataset) {
+    const cdataset_ext *ext = (const cdataset_ext *)dataset->ext;
+    return ext != NULL ? ext->zones : NULL;
+}
+
+// =================================================================
+// Lookup index
+// =================================================================
+//
+// The sorted array answers range queries by binary search; the hash table
+// maps each value to the first position holding it. -0.0 hashes like
+// +0.0 so lookups agree with `==`, and NaN is never indexed.
+
+typedef struct {
+    double value;
+    size_t position;
+} cdataset_index_entry;
+
+typedef struct {
+    const double *data;             // buffer the index was built for
+    size_t size;
+    cdataset_index_entry *sorted;   // non-NaN values by value, then position
+    size_t count;
+    size_t *slots;                  // position + 1 per bucket, 0 if empty
+    size_t mask;
+} cdataset_index;
+
+static int fscl_data_index_compare(const void *a, const void *b) {
+    const cdataset_index_entry *x = (const cdataset_index_entry *)a;
+    const cdataset_index_entry *y = (const cdataset_index_entry *)b;
+    if (x->value != y->value) {
+        return x->value < y->value ? -1 : 1;
+    }
+    return (x->position > y->position) - (x->position < y->position);
+}
+
+static size_t fscl_data_index_hash(double value) {
+    uint64_t bits;
+    if (value == 0.0) {
+        value = 0.0;
+    }
+    memcpy(&bits, &value, sizeof(bits));
+    bits ^= bits >> 33;
+    bits *= 0xFF51AFD7ED558CCDull;
+    bits ^= bits >> 33;
+    bits *= 0xC4CEB9FE1A85EC53ull;
+    bits ^= bits >> 33;
+    return (size_t)bits;
+}
+
+// Function to fetch the index if it still describes the dataset buffer
+static const cdataset_index *fscl_data_index_get(const cdataset *dataset) {
+    const cdataset_index *index = (const cdataset_index *)fscl_data_ext_index(dataset);
+    if (index != NULL && index->data == dataset->data && index->size == dataset->size) {
+        return index;
+    }
+    return NULL;
+}
+
+// =================================================================
+// Zone maps
+// =================================================================
+//
+// Each block of FSCL_DATA_ZONE elements keeps the minimum and maximum of
+// its non-NaN values, so range lookups skip blocks that cannot match. An
+// all-NaN block has min = +inf and max = -inf and never matches.
+
+// Elements summarized by one zone (32 KiB)
+#define FSCL_DATA_ZONE 4096
+
+typedef struct {
+    const double *data;     // buffer the zones were computed for
+    size_t size;
+    size_t count;           // number of blocks
+    double *min;
+    double *max;
+} cdataset_zones;
+
+// Function to fetch the zone map if it still describes the dataset buffer
+static const cdataset_zones *fscl_data_zones_get(const cdataset *dataset) {
+    const cdataset_zones *zones = (const cdataset_zones *)fscl_data_ext_zones(dataset);
+    if (zones != NULL && zones->data == dataset->data && zones->size == dataset->size) {
+        return zones;
+    }
+    return NULL;
+}
+
+// Function to summarize blocks [begin, end) of a zone map
+static void fscl_data_zones_chunk(void *context, size_t begin, size_t end) {
+    cdataset_zones *zones = (cdataset_zones *)context;
+    const cdataset_kernels *kernels = fscl_data_kernels();
+
+    for (size_t b = begin; b < end; ++b) {
+        size_t first = b * FSCL_DATA_ZONE;
+        size_t last = zones->size - first > FSCL_DATA_ZONE ? first + FSCL_DATA_ZONE : zones->size;
+
+        // The kernels skip NaN once their first element is a number
+        while (first < last && isnan(zones->data[first])) {
+            ++first;
+        }
+        if (first == last) {
+            zones->min[b] = INFINITY;
+            zones->max[b] = -INFINITY;
+        } else {
+            zones->min[b] = kernels->min(zones->data + first, last - first);
+            zones->max[b] = kernels->max(zones->data + first, last - first);
+        }
+    }
+}
+
+// Function to recompute the whole zone map after a library mutator
+static void fscl_data_zones_refresh(cdataset *dataset) {
+    if (fscl_data_ext_zones(dataset) != NULL) {
+        fscl_data_zones_update(dataset, 0, dataset->size);
+    }
+}
+
+// =================================================================
+// Dataset functions
+// =================================================================
 
 // Function to create a dataset
 void fscl_data_create(cdataset *dataset, size_t size) {
     dataset->data = (double *)malloc(size * sizeof(double));
     dataset->size = size;
+    dataset->ext = NULL;
+
+    // First touch from the pool so each page lands on the NUMA node of the
+    // thread that will later process the same chunk
+    if (dataset->data != NULL && size > FSCL_DATA_CHUNK && fscl_data_parallel(FSCL_DATA_EXEC_DEFAULT)) {
+        cdataset_elementwise op = {NULL, NULL, dataset->data, 0.0};
+        fscl_data_for(FSCL_DATA_EXEC_DEFAULT, size, FSCL_DATA_CHUNK, fscl_data_zero_chunk, &op);
+    }
 }
 
 // Function to erase memory allocated for a dataset
 void fscl_data_erase(cdataset *dataset) {
-    free(dataset->data);
+    fscl_data_index_drop(dataset);
+    fscl_data_zones_drop(dataset);
+    cdataset_ext *ext = (cdataset_ext *)dataset->ext;
+    if (ext != NULL && ext->storage != NULL) {
+        ext->release(ext->storage);
+    } else {
+        free(dataset->data);
+    }
+    free(ext);
+    dataset->ext = NULL;
+    dataset->data = NULL;
     dataset->size = 0;
 }
 
@@ -36,83 +1124,237 @@ void fscl_data_print(const cdataset *dataset) {
     printf("]\n");
 }
 
-// Function to fill the dataset with random values
-void fscl_data_fill_random(cdataset *dataset) {
-    for (size_t i = 0; i < dataset->size; ++i) {
-        dataset->data[i] = ((double)rand() / RAND_MAX) * 100.0; // Adjust range as needed
+// Function to calculate the mean of the dataset
+double fscl_data_mean(const cdataset *dataset) {
+    cdataset_reduction job = {dataset->data, NULL, FSCL_DATA_REDUCE_SUM, NULL, NULL};
+    return fscl_data_reduce(&job, dataset->size) / dataset->size;
+}
+
+// Elements per block folded into the running statistics; small enough that
+// the second look at a block is served from L1 instead of memory.
+#define FSCL_DATA_STATS_BLOCK 512
+
+// Function to fold one block into an accumulator: the block's own sum and
+// squared deviations come from two sweeps over L1, then one merge
+static void fscl_data_stats_block(const double *data, size_t size, caccumulator *accum) {
+    caccumulator block;
+    fscl_accum_init(&block);
+
+    for (size_t i = 0; i < size; ++i) {
+        double value = data[i];
+        if (isnan(value)) {
+            continue;
+        }
+        ++block.count;
+        block.sum += value;
+        if (value < block.min) block.min = value;
+        if (value > block.max) block.max = value;
+    }
+
+    block.nan_count = size - block.count;
+    if (block.count > 0) {
+        block.mean = block.sum / (double)block.count;
+        for (size_t i = 0; i < size; ++i) {
+            double diff = data[i] - block.mean;
+            if (!isnan(diff)) {
+                block.m2 += diff * diff;
+            }
+        }
     }
+    fscl_accum_merge(accum, &block);
 }
 
-// Function to calculate the mean of the dataset
-double fscl_data_mean(const cdataset *dataset) {
-    double sum = 0.0;
-    for (size_t i = 0; i < dataset->size; ++i) {
-        sum += dataset->data[i];
+// Function to compute the statistics of one contiguous range
+static void fscl_data_stats_range(const double *data, size_t size, cdataset_stats *stats) {
+    caccumulator accum;
+    fscl_accum_init(&accum);
+
+    for (size_t i = 0; i < size; i += FSCL_DATA_STATS_BLOCK) {
+        size_t block = size - i;
+        if (block > FSCL_DATA_STATS_BLOCK) {
+            block = FSCL_DATA_STATS_BLOCK;
+        }
+        fscl_data_stats_block(data + i, block, &accum);
     }
-    return sum / dataset->size;
+    fscl_accum_stats(&accum, stats);
+}
+
+static void fscl_data_stats_chunk(void *context, size_t begin, size_t end) {
+    cdataset_reduction *job = (cdataset_reduction *)context;
+    fscl_data_stats_range(job->data1 + begin, end - begin, &job->stats[begin / FSCL_DATA_CHUNK]);
+}
+
+// Function to compute all summary statistics in one pass over the data.
+// Chunks are merged in order through an accumulator on both paths, so
+// the result does not depend on the number of threads.
+void fscl_data_stats(const cdataset *dataset, cdataset_stats *stats) {
+    size_t size = dataset->size;
+    size_t chunks = (size + FSCL_DATA_CHUNK - 1) / FSCL_DATA_CHUNK;
+    cdataset_stats part;
+    caccumulator total;
+
+    if (chunks <= 1) {
+        fscl_data_stats_range(dataset->data, size, stats);
+        return;
+    }
+
+    fscl_accum_init(&total);
+    cdataset_reduction job = {dataset->data, NULL, FSCL_DATA_REDUCE_SUM, NULL, NULL};
+    if (fscl_data_parallel(FSCL_DATA_EXEC_DEFAULT)) {
+        job.stats = (cdataset_stats *)malloc(chunks * sizeof(cdataset_stats));
+    }
+
+    if (job.stats != NULL) {
+        fscl_data_for(FSCL_DATA_EXEC_DEFAULT, size, FSCL_DATA_CHUNK, fscl_data_stats_chunk, &job);
+        for (size_t c = 0; c < chunks; ++c) {
+            fscl_accum_update_stats(&total, &job.stats[c]);
+        }
+        free(job.stats);
+    } else {
+        for (size_t begin = 0; begin < size; begin += FSCL_DATA_CHUNK) {
+            size_t end = size - begin > FSCL_DATA_CHUNK ? begin + FSCL_DATA_CHUNK : size;
+            fscl_data_stats_range(dataset->data + begin, end - begin, &part);
+            fscl_accum_update_stats(&total, &part);
+        }
+    }
+    fscl_accum_stats(&total, stats);
+}
+
+// Function to combine the statistics of two parts of the data
+void fscl_data_stats_merge(cdataset_stats *stats, const cdataset_stats *other) {
+    caccumulator total;
+    fscl_accum_init(&total);
+    fscl_accum_update_stats(&total, stats);
+    fscl_accum_update_stats(&total, other);
+    fscl_accum_stats(&total, stats);
+}
+
+// Series handed to one thread at a time by fscl_data_stats_batch
+#define FSCL_DATA_BATCH_SERIES 256
+
+// Series of a batch, ordered by length so neighbouring lanes end together
+typedef struct {
+    size_t size;
+    size_t series;
+} cdataset_batch_entry;
+
+typedef struct {
+    const double *values;
+    const size_t *offsets;
+    cdataset_stats *stats;
+} cdataset_batch;
+
+static int fscl_data_batch_compare(const void *a, const void *b) {
+    size_t x = ((const cdataset_batch_entry *)a)->size, y = ((const cdataset_batch_entry *)b)->size;
+    return (x > y) - (x < y);
+}
+
+static void fscl_data_stats_batch_chunk(void *context, size_t begin, size_t end) {
+    cdataset_batch *job = (cdataset_batch *)context;
+    cdataset_batch_entry order[FSCL_DATA_BATCH_SERIES];
+    size_t count = end - begin;
+
+    for (size_t s = 0; s < count; ++s) {
+        order[s].series = begin + s;
+        order[s].size = job->offsets[begin + s + 1] - job->offsets[begin + s];
+    }
+    qsort(order, count, sizeof(cdataset_batch_entry), fscl_data_batch_compare);
+
+    for (size_t s = 0; s < count; s += FSCL_DATA_BATCH_LANES) {
+        const double *data[FSCL_DATA_BATCH_LANES];
+        size_t sizes[FSCL_DATA_BATCH_LANES];
+        cdataset_stats *out[FSCL_DATA_BATCH_LANES];
+        size_t lanes = count - s < FSCL_DATA_BATCH_LANES ? count - s : FSCL_DATA_BATCH_LANES;
+
+        for (size_t k = 0; k < lanes; ++k) {
+            data[k] = job->values + job->offsets[order[s + k].series];
+            sizes[k] = order[s + k].size;
+            out[k] = &job->stats[order[s + k].series];
+        }
+        fscl_data_kernels()->stats_lanes(data, sizes, lanes, out);
+    }
+}
+
+// Function to compute the statistics of many series stored back to back
+void fscl_data_stats_batch(const double *values, const size_t *offsets, size_t num_series, cdataset_stats *stats) {
+    cdataset_batch job = {values, offsets, stats};
+    fscl_data_for(FSCL_DATA_EXEC_DEFAULT, num_series, FSCL_DATA_BATCH_SERIES, fscl_data_stats_batch_chunk, &job);
 }
 
 // Function to calculate the standard deviation of the dataset
 double fscl_data_std_dev(const cdataset *dataset) {
-    double mean = fscl_data_mean(dataset);
-    double sum_squared_diff = 0.0;
+    cdataset_stats stats;
+    fscl_data_stats(dataset, &stats);
 
-    for (size_t i = 0; i < dataset->size; ++i) {
-        double diff = dataset->data[i] - mean;
-        sum_squared_diff += diff * diff;
+    if (stats.nan_count > 0) {
+        return NAN;
     }
-
-    return sqrt(sum_squared_diff / dataset->size);
+    return sqrt(stats.variance);
 }
 
 // Function to scale the dataset by a given factor
 void fscl_data_scale(cdataset *dataset, double factor) {
-    for (size_t i = 0; i < dataset->size; ++i) {
-        dataset->data[i] *= factor;
-    }
+    fscl_data_scale_ex(dataset, factor, FSCL_DATA_EXEC_DEFAULT);
+}
+
+// Function to scale the dataset with an explicit execution policy
+void fscl_data_scale_ex(cdataset *dataset, double factor, cdataset_exec policy) {
+    fscl_data_index_drop(dataset);
+    cdataset_elementwise op = {NULL, NULL, dataset->data, factor};
+    fscl_data_for(policy, dataset->size, FSCL_DATA_CHUNK, fscl_data_scale_chunk, &op);
+    fscl_data_zones_refresh(dataset);
 }
 
 // Function to perform element-wise addition of two datasets
 void fscl_data_add(const cdataset *dataset1, const cdataset *dataset2, cdataset *result) {
-    if (dataset1->size != dataset2->size || result->size != dataset1->size) {
-        // Handle error: sizes must match
-        return;
-    }
+    fscl_data_binary(dataset1, dataset2, result, FSCL_DATA_EXEC_DEFAULT, fscl_data_add_chunk);
+}
 
-    for (size_t i = 0; i < dataset1->size; ++i) {
-        result->data[i] = dataset1->data[i] + dataset2->data[i];
-    }
+// Function to perform element-wise addition with an explicit execution policy
+void fscl_data_add_ex(const cdataset *dataset1, const cdataset *dataset2, cdataset *result, cdataset_exec policy) {
+    fscl_data_binary(dataset1, dataset2, result, policy, fscl_data_add_chunk);
 }
 
 // Function to find the minimum value in the dataset
 double fscl_data_min(const cdataset *dataset) {
-    double min_val = dataset->data[0];
-    for (size_t i = 1; i < dataset->size; ++i) {
-        if (dataset->data[i] < min_val) {
-            min_val = dataset->data[i];
+    if (dataset->size == 0) {
+        return NAN;
+    }
+    const cdataset_zones *zones = fscl_data_zones_get(dataset);
+    if (zones != NULL && !isnan(dataset->data[0])) {
+        // Same result as the kernels, answered from the block summaries
+        double result = zones->min[0];
+        for (size_t b = 1; b < zones->count; ++b) {
+            if (zones->min[b] < result) result = zones->min[b];
         }
+        return result;
     }
-    return min_val;
+    cdataset_reduction job = {dataset->data, NULL, FSCL_DATA_REDUCE_MIN, NULL, NULL};
+    return fscl_data_reduce(&job, dataset->size);
 }
 
 // Function to find the maximum value in the dataset
 double fscl_data_max(const cdataset *dataset) {
-    double max_val = dataset->data[0];
-    for (size_t i = 1; i < dataset->size; ++i) {
-        if (dataset->data[i] > max_val) {
-            max_val = dataset->data[i];
+    if (dataset->size == 0) {
+        return NAN;
+    }
+    const cdataset_zones *zones = fscl_data_zones_get(dataset);
+    if (zones != NULL && !isnan(dataset->data[0])) {
+        // Same result as the kernels, answered from the block summaries
+        double result = zones->max[0];
+        for (size_t b = 1; b < zones->count; ++b) {
+            if (zones->max[b] > result) result = zones->max[b];
         }
+        return result;
     }
-    return max_val;
+    cdataset_reduction job = {dataset->data, NULL, FSCL_DATA_REDUCE_MAX, NULL, NULL};
+    return fscl_data_reduce(&job, dataset->size);
 }
 
 // Function to calculate the sum of all elements in the dataset
 double fscl_data_sum(const cdataset *dataset) {
-    double sum = 0.0;
-    for (size_t i = 0; i < dataset->size; ++i) {
-        sum += dataset->data[i];
-    }
-    return sum;
+    cdataset_reduction job = {dataset->data, NULL, FSCL_DATA_REDUCE_SUM, NULL, NULL};
+    return fscl_data_reduce(&job, dataset->size);
 }
 
 // Function to calculate the product of all elements in the dataset
@@ -126,6 +1368,37 @@ double fscl_data_product(const cdataset *dataset) {
 
 // Modified fscl_data_find without using ssize_t
 int fscl_data_find(const cdataset *dataset, double value) {
+    const cdataset_index *index = fscl_data_index_get(dataset);
+    if (index != NULL) {
+        if (isnan(value)) {
+            return -1;
+        }
+        for (size_t slot = fscl_data_index_hash(value) & index->mask; index->slots[slot] != 0;
+             slot = (slot + 1) & index->mask) {
+            size_t position = index->slots[slot] - 1;
+            if (dataset->data[position] == value) {
+                return (int)position;
+            }
+        }
+        return -1;
+    }
+
+    const cdataset_zones *zones = fscl_data_zones_get(dataset);
+    if (zones != NULL) {
+        for (size_t b = 0; b < zones->count; ++b) {
+            if (!(value >= zones->min[b] && value <= zones->max[b])) {
+                continue;
+            }
+            size_t last = dataset->size - b * FSCL_DATA_ZONE > FSCL_DATA_ZONE ? (b + 1) * FSCL_DATA_ZONE : dataset->size;
+            for (size_t i = b * FSCL_DATA_ZONE; i < last; ++i) {
+                if (dataset->data[i] == value) {
+                    return (int)i;
+                }
+            }
+        }
+        return -1;
+    }
+
     for (size_t i = 0; i < dataset->size; ++i) {
         if (dataset->data[i] == value) {
             return (int)i; // Found at index i
@@ -134,25 +1407,217 @@ int fscl_data_find(const cdataset *dataset, double value) {
     return -1; // Value not found
 }
 
-// Function to perform element-wise multiplication of two datasets
-void fscl_data_multiply(const cdataset *dataset1, const cdataset *dataset2, cdataset *result) {
-    if (dataset1->size != dataset2->size || result->size != dataset1->size) {
-        // Handle error: sizes must match
+// Function to find the elements within [low, high]
+size_t fscl_data_find_range(const cdataset *dataset, double low, double high, size_t *positions, size_t capacity) {
+    size_t found = 0;
+    if (isnan(low) || isnan(high)) {
+        return 0;
+    }
+
+    const cdataset_index *index = fscl_data_index_get(dataset);
+    if (index != NULL) {
+        size_t first = 0, last = index->count;
+        while (first < last) {
+            size_t middle = first + (last - first) / 2;
+            if (index->sorted[middle].value < low) {
+                first = middle + 1;
+            } else {
+                last = middle;
+            }
+        }
+        for (size_t i = first; i < index->count && index->sorted[i].value <= high; ++i) {
+            if (found < capacity) {
+                positions[found] = index->sorted[i].position;
+            }
+            ++found;
+        }
+        return found;
+    }
+
+    const cdataset_zones *zones = fscl_data_zones_get(dataset);
+    size_t blocks = zones != NULL ? zones->count : 1;
+    size_t span = zones != NULL ? FSCL_DATA_ZONE : dataset->size;
+    for (size_t b = 0; b < blocks; ++b) {
+        if (zones != NULL && (zones->max[b] < low || zones->min[b] > high)) {
+            continue;
+        }
+        size_t last = dataset->size - b * span > span ? (b + 1) * span : dataset->size;
+        for (size_t i = b * span; i < last; ++i) {
+            if (dataset->data[i] >= low && dataset->data[i] <= high) {
+                if (found < capacity) {
+                    positions[found] = i;
+                }
+                ++found;
+            }
+        }
+    }
+    return found;
+}
+
+// Function to build the lookup index of a dataset
+int fscl_data_index_build(cdataset *dataset) {
+    fscl_data_index_drop(dataset);
+
+    size_t buckets = 16;
+    while (buckets < 2 * dataset->size) {
+        buckets <<= 1;
+    }
+
+    cdataset_index *index = (cdataset_index *)malloc(sizeof(cdataset_index));
+    if (index == NULL) {
+        fprintf(stderr, "Error: Memory allocation failed for dataset index.\n");
+        return -1;
+    }
+    index->sorted = (cdataset_index_entry *)malloc((dataset->size > 0 ? dataset->size : 1) * sizeof(cdataset_index_entry));
+    index->slots = (size_t *)calloc(buckets, sizeof(size_t));
+    if (index->sorted == NULL || index->slots == NULL) {
+        fprintf(stderr, "Error: Memory allocation failed for dataset index.\n");
+        free(index->sorted);
+        free(index->slots);
+        free(index);
+        return -1;
+    }
+    index->data = dataset->data;
+    index->size = dataset->size;
+    index->mask = buckets - 1;
+    index->count = 0;
+
+    for (size_t i = 0; i < dataset->size; ++i) {
+        double value = dataset->data[i];
+        if (isnan(value)) {
+            continue;
+        }
+        index->sorted[index->count].value = value;
+        index->sorted[index->count].position = i;
+        ++index->count;
+
+        // Keep only the first position of each value
+        size_t slot = fscl_data_index_hash(value) & index->mask;
+        while (index->slots[slot] != 0 && dataset->data[index->slots[slot] - 1] != value) {
+            slot = (slot + 1) & index->mask;
+        }
+        if (index->slots[slot] == 0) {
+            index->slots[slot] = i + 1;
+        }
+    }
+    qsort(index->sorted, index->count, sizeof(cdataset_index_entry), fscl_data_index_compare);
+
+    cdataset_ext *ext = fscl_data_ext_open(dataset);
+    if (ext == NULL) {
+        fprintf(stderr, "Error: Memory allocation failed for dataset index.\n");
+        free(index->sorted);
+        free(index->slots);
+        free(index);
+        return -1;
+    }
+    ext->index = index;
+    return 0;
+}
+
+// Function to free the lookup index of a dataset
+void fscl_data_index_drop(cdataset *dataset) {
+    cdataset_ext *ext = (cdataset_ext *)dataset->ext;
+    if (ext == NULL || ext->index == NULL) {
         return;
     }
+    cdataset_index *index = (cdataset_index *)ext->index;
+    free(index->sorted);
+    free(index->slots);
+    free(index);
+    ext->index = NULL;
+    fscl_data_ext_close(dataset);
+}
+
+// Function to build the zone map of a dataset
+int fscl_data_zones_build(cdataset *dataset) {
+    fscl_data_zones_drop(dataset);
+
+    cdataset_zones *zones = (cdataset_zones *)calloc(1, sizeof(cdataset_zones));
+    cdataset_ext *ext = zones != NULL ? fscl_data_ext_open(dataset) : NULL;
+    if (ext == NULL) {
+        fprintf(stderr, "Error: Memory allocation failed for dataset zone map.\n");
+        free(zones);
+        return -1;
+    }
+    ext->zones = zones;
+    return fscl_data_zones_update(dataset, 0, dataset->size);
+}
+
+// Function to recompute the zones covering [begin, end)
+int fscl_data_zones_update(cdataset *dataset, size_t begin, size_t end) {
+    cdataset_zones *zones = (cdataset_zones *)fscl_data_ext_zones(dataset);
+    if (zones == NULL) {
+        return 0;
+    }
+
+    if (zones->data != dataset->data || zones->size != dataset->size) {
+        // Resized or replaced buffer: every block has to be recomputed
+        size_t count = (dataset->size + FSCL_DATA_ZONE - 1) / FSCL_DATA_ZONE;
+        if (count != zones->count) {
+            double *bounds = (double *)realloc(zones->min, (count > 0 ? 2 * count : 1) * sizeof(double));
+            if (bounds == NULL) {
+                fprintf(stderr, "Error: Memory allocation failed for dataset zone map.\n");
+                fscl_data_zones_drop(dataset);
+                return -1;
+            }
+            zones->min = bounds;
+            zones->max = bounds + count;
+            zones->count = count;
+        }
+        zones->data = dataset->data;
+        zones->size = dataset->size;
+        begin = 0;
+        end = dataset->size;
+    }
 
-    for (size_t i = 0; i < dataset1->size; ++i) {
-        result->data[i] = dataset1->data[i] * dataset2->data[i];
+    if (end > dataset->size) {
+        end = dataset->size;
+    }
+    if (begin >= end) {
+        return 0;
+    }
+    // Summarize through a view that starts at the first touched block
+    size_t first = begin / FSCL_DATA_ZONE;
+    size_t last = (end + FSCL_DATA_ZONE - 1) / FSCL_DATA_ZONE;
+    cdataset_zones view = {zones->data + first * FSCL_DATA_ZONE, zones->size - first * FSCL_DATA_ZONE,
+                           last - first, zones->min + first, zones->max + first};
+    fscl_data_for(FSCL_DATA_EXEC_DEFAULT, view.count, FSCL_DATA_CHUNK / FSCL_DATA_ZONE, fscl_data_zones_chunk, &view);
+    return 0;
+}
+
+// Function to free the zone map of a dataset
+void fscl_data_zones_drop(cdataset *dataset) {
+    cdataset_ext *ext = (cdataset_ext *)dataset->ext;
+    if (ext == NULL || ext->zones == NULL) {
+        return;
     }
+    cdataset_zones *zones = (cdataset_zones *)ext->zones;
+    free(zones->min);
+    free(zones);
+    ext->zones = NULL;
+    fscl_data_ext_close(dataset);
+}
+
+// Function to perform element-wise multiplication of two datasets
+void fscl_data_multiply(const cdataset *dataset1, const cdataset *dataset2, cdataset *result) {
+    fscl_data_binary(dataset1, dataset2, result, FSCL_DATA_EXEC_DEFAULT, fscl_data_multiply_chunk);
+}
+
+// Function to perform element-wise multiplication with an explicit execution policy
+void fscl_data_multiply_ex(const cdataset *dataset1, const cdataset *dataset2, cdataset *result, cdataset_exec policy) {
+    fscl_data_binary(dataset1, dataset2, result, policy, fscl_data_multiply_chunk);
 }
 
 // Function to normalize the dataset between 0 and 1
 void fscl_data_normalize(cdataset *dataset) {
-    double min_val = fscl_data_min(dataset);
-    double max_val = fscl_data_max(dataset);
-    double range = max_val - min_val;
+    fscl_data_index_drop(dataset);
+    cdataset_stats stats;
+    fscl_data_stats(dataset, &stats);
+
+    double min_val = stats.min;
+    double range = stats.max - stats.min;
 
-    if (range == 0.0) {
+    if (range == 0.0 || isnan(range)) {
         // Handle case where all values are the same to avoid division by zero
         return;
     }
@@ -160,18 +1625,17 @@ void fscl_data_normalize(cdataset *dataset) {
     for (size_t i = 0; i < dataset->size; ++i) {
         dataset->data[i] = (dataset->data[i] - min_val) / range;
     }
+    fscl_data_zones_refresh(dataset);
 }
 
 // Function to perform element-wise subtraction of two datasets
 void fscl_data_subtract(const cdataset *dataset1, const cdataset *dataset2, cdataset *result) {
-    if (dataset1->size != dataset2->size || result->size != dataset1->size) {
-        // Handle error: sizes must match
-        return;
-    }
+    fscl_data_binary(dataset1, dataset2, result, FSCL_DATA_EXEC_DEFAULT, fscl_data_subtract_chunk);
+}
 
-    for (size_t i = 0; i < dataset1->size; ++i) {
-        result->data[i] = dataset1->data[i] - dataset2->data[i];
-    }
+// Function to perform element-wise subtraction with an explicit execution policy
+void fscl_data_subtract_ex(const cdataset *dataset1, const cdataset *dataset2, cdataset *result, cdataset_exec policy) {
+    fscl_data_binary(dataset1, dataset2, result, policy, fscl_data_subtract_chunk);
 }
 
 // Function to calculate the dot product of two datasets
@@ -181,73 +1645,190 @@ double fscl_data_dot_product(const cdataset *dataset1, const cdataset *dataset2)
         return 0.0;
     }
 
-    double dot_product = 0.0;
-    for (size_t i = 0; i < dataset1->size; ++i) {
-        dot_product += dataset1->data[i] * dataset2->data[i];
-    }
-
-    return dot_product;
+    cdataset_reduction job = {dataset1->data, dataset2->data, FSCL_DATA_REDUCE_DOT, NULL, NULL};
+    return fscl_data_reduce(&job, dataset1->size);
 }
 
 // Function to remove missing values from the dataset
 void fscl_data_remove_missing(cdataset *dataset) {
-    size_t i, j = 0;
-    
-    for (i = 0; i < dataset->size; ++i) {
-        if (!isnan(dataset->data[i])) {
-            dataset->data[j++] = dataset->data[i];
-        }
-    }
-
-    dataset->size = j;
+    fscl_data_index_drop(dataset);
+    dataset->size = fscl_data_kernels()->compact(dataset->data, dataset->size, -INFINITY, INFINITY);
+    fscl_data_zones_refresh(dataset);
 }
 
 // Function to replace missing values with a specified value
 void fscl_data_replace_missing(cdataset *dataset, double replacement_value) {
+    fscl_data_index_drop(dataset);
     for (size_t i = 0; i < dataset->size; ++i) {
         if (isnan(dataset->data[i])) {
             dataset->data[i] = replacement_value;
         }
     }
+    fscl_data_zones_refresh(dataset);
 }
 
 // Function to remove outliers from the dataset using a z-score threshold
 void fscl_data_remove_outliers(cdataset *dataset, double z_threshold) {
-    double mean = fscl_data_mean(dataset);
-    double std_dev = fscl_data_std_dev(dataset);
+    fscl_data_index_drop(dataset);
+    cdataset_stats stats;
+    fscl_data_stats(dataset, &stats);
 
-    for (size_t i = 0; i < dataset->size; ++i) {
-        double z_score = (dataset->data[i] - mean) / std_dev;
-        if (fabs(z_score) > z_threshold) {
-            dataset->data[i] = NAN;  // Mark outlier as missing value
-        }
+    // |z| <= threshold as a value range, so one compaction sweep both
+    // decides keep/drop and packs the survivors
+    double spread = z_threshold * sqrt(stats.variance);
+    double low = stats.mean - spread;
+    double high = stats.mean + spread;
+    if (isnan(low) || isnan(high)) {
+        // No finite bound (NaN threshold, or infinite threshold on constant data)
+        low = -INFINITY;
+        high = INFINITY;
     }
 
-    fscl_data_remove_missing(dataset);
+    dataset->size = fscl_data_kernels()->compact(dataset->data, dataset->size, low, high);
+    fscl_data_zones_refresh(dataset);
 }
 
 // Function to standardize the dataset (subtract mean, divide by standard deviation)
 void fscl_data_standardize(cdataset *dataset) {
-    double mean = fscl_data_mean(dataset);
-    double std_dev = fscl_data_std_dev(dataset);
+    fscl_data_index_drop(dataset);
+    cdataset_stats stats;
+    fscl_data_stats(dataset, &stats);
+
+    double mean = stats.mean;
+    double std_dev = sqrt(stats.variance);
+
+    if (std_dev == 0.0 || isnan(std_dev)) {
+        // Constant or empty dataset, nothing to scale
+        return;
+    }
 
     for (size_t i = 0; i < dataset->size; ++i) {
         dataset->data[i] = (dataset->data[i] - mean) / std_dev;
     }
+    fscl_data_zones_refresh(dataset);
+}
+
+// Shared state of the two feature normalization sweeps
+typedef struct {
+    double *data;
+    size_t features;
+    size_t grain;      // rows per chunk
+    double *low;       // per chunk and feature minimum, then final minimum
+    double *high;      // per chunk and feature maximum, then final range
+} cdataset_features;
+
+// Function to find the per-feature range of one chunk of rows
+static void fscl_data_features_range(void *context, size_t begin, size_t end) {
+    cdataset_features *job = (cdataset_features *)context;
+    size_t features = job->features;
+    double *low = job->low + (begin / job->grain) * features;
+    double *high = job->high + (begin / job->grain) * features;
+    const double *row = job->data + begin * features;
+
+    for (size_t f = 0; f < features; ++f) {
+        low[f] = INFINITY;
+        high[f] = -INFINITY;
+    }
+
+    if (features == 1) {
+        // Kernels skip NaN except in the first slot, so start past any NaN
+        size_t count = end - begin;
+        size_t first = 0;
+        while (first < count && isnan(row[first])) {
+            ++first;
+        }
+        if (first < count) {
+            low[0] = fscl_data_kernels()->min(row + first, count - first);
+            high[0] = fscl_data_kernels()->max(row + first, count - first);
+        }
+        return;
+    }
+
+    for (size_t r = begin; r < end; ++r, row += features) {
+        for (size_t f = 0; f < features; ++f) {
+            if (row[f] < low[f]) low[f] = row[f];
+            if (row[f] > high[f]) high[f] = row[f];
+        }
+    }
+}
+
+// Function to rescale one chunk of rows into [0, 1]
+static void fscl_data_features_apply(void *context, size_t begin, size_t end) {
+    cdataset_features *job = (cdataset_features *)context;
+    size_t features = job->features;
+    double *row = job->data + begin * features;
+
+    if (features == 1) {
+        double min_val = job->low[0], range = job->high[0];
+        for (size_t i = 0; i < end - begin; ++i) {
+            row[i] = (row[i] - min_val) / range;
+        }
+        return;
+    }
+
+    for (size_t r = begin; r < end; ++r, row += features) {
+        for (size_t f = 0; f < features; ++f) {
+            row[f] = (row[f] - job->low[f]) / job->high[f];
+        }
+    }
+}
+
+// Function to normalize each column of a row-major feature matrix
+void fscl_data_normalize_columns(cdataset *dataset, size_t num_features) {
+    fscl_data_index_drop(dataset);
+    if (num_features == 0 || dataset->size < num_features) {
+        return;
+    }
+
+    size_t rows = dataset->size / num_features;
+    cdataset_features job;
+    job.data = dataset->data;
+    job.features = num_features;
+    job.grain = FSCL_DATA_CHUNK / num_features > 0 ? FSCL_DATA_CHUNK / num_features : 1;
+
+    size_t chunks = (rows + job.grain - 1) / job.grain;
+    job.low = (double *)malloc(2 * chunks * num_features * sizeof(double));
+    if (job.low == NULL) {
+        return;
+    }
+    job.high = job.low + chunks * num_features;
+
+    // Pass 1: per-chunk ranges, merged in chunk order
+    fscl_data_for(FSCL_DATA_EXEC_DEFAULT, rows, job.grain, fscl_data_features_range, &job);
+    for (size_t c = 1; c < chunks; ++c) {
+        for (size_t f = 0; f < num_features; ++f) {
+            double low = job.low[c * num_features + f];
+            double high = job.high[c * num_features + f];
+            if (low < job.low[f]) job.low[f] = low;
+            if (high > job.high[f]) job.high[f] = high;
+        }
+    }
+    for (size_t f = 0; f < num_features; ++f) {
+        double range = job.high[f] - job.low[f];
+        // Constant columns map to 0, all-NaN columns stay NaN
+        job.high[f] = range > 0.0 ? range : 1.0;
+    }
+
+    // Pass 2: rescale in place
+    fscl_data_for(FSCL_DATA_EXEC_DEFAULT, rows, job.grain, fscl_data_features_apply, &job);
+    fscl_data_zones_refresh(dataset);
+
+    free(job.low);
 }
 
 // Function to normalize numeric features in the dataset
 void fscl_data_normalize_features(cdataset *dataset) {
-    for (size_t i = 0; i < dataset->size; ++i) {
-        double min_val = fscl_data_min(dataset);
-        double max_val = fscl_data_max(dataset);
-        dataset->data[i] = (dataset->data[i] - min_val) / (max_val - min_val);
-    }
+    fscl_data_normalize_columns(dataset, 1);
 }
 
 // Function to encode categorical variables using one-hot encoding
 void fscl_data_one_hot_encode(cdataset *dataset, size_t feature_index) {
     // Assuming feature at feature_index is categorical with integer values
+    if (fscl_data_storage_get(dataset) != NULL) {
+        fprintf(stderr, "Error: A mapped dataset cannot be resized.\n");
+        return;
+    }
+    fscl_data_index_drop(dataset);
 
     // Determine the number of unique categories in the specified feature
     size_t num_categories = 0;
@@ -272,4 +1853,5 @@ void fscl_data_one_hot_encode(cdataset *dataset, size_t feature_index) {
         size_t category = (size_t)dataset->data[i];
         dataset->data[original_size + category] = 1.0;
     }
+    fscl_data_zones_refresh(dataset);
 }
@@ -0,0 +1,552 @@
+/*
+==============================================================================
+Author: Michael Gene Brockus (Dreamer)
+Email: michaelbrockus@gmail.com
+Organization: Fossil Logic
+Description: 
+    This file is part of the Fossil Logic project, where innovation meets
+    excellence in software development. Michael Gene Brockus, also known as
+    "Dreamer," is a dedicated contributor to this project. For any inquiries,
+    feel free to contact Michael at michaelbrockus@gmail.com.
+==============================================================================
+*/
+#include "fossil/xscience/groupby.h"
+#include "fossil/xscience/parallel.h"
+#include <string.h>
+#include <stdint.h>
+
+// Rows per chunk of the key scan
+#define FSCL_GROUP_CHUNK ((size_t)1 << 16)
+
+// Distinct keys in the first chunk above which the rows are partitioned
+// first; below it one small table per chunk stays in cache
+#define FSCL_GROUP_SMALL 4096
+
+// Partitions of the radix pre-pass, picked by the top bits of the hash;
+// sized so a partition holds about one chunk of rows
+#define FSCL_GROUP_MIN_BITS 4
+#define FSCL_GROUP_MAX_BITS 10
+
+#define FSCL_GROUP_EMPTY ((size_t)-1)
+
+// Table status
+#define FSCL_GROUP_NOMEM 1
+#define FSCL_GROUP_BADKEY 2
+
+// Slot of the open-addressing table; key and group share a cache line
+typedef struct {
+    int64_t key;
+    size_t group;
+} cgroup_slot;
+
+// Linear-probing hash table over dense per-group records. A record is
+// {count, sum and valid count per value}, so one row touches one slot
+// and one record.
+typedef struct {
+    cgroup_slot *slots;
+    size_t mask;
+    int64_t *keys;
+    double *records;
+    size_t width;      // doubles per record
+    size_t size;
+    size_t allocated;
+    int status;
+} cgroup_table;
+
+typedef struct {
+    const cdataset *keys;
+    const cdataset *values;
+    size_t num_values;
+    cgroup_table *tables;    // one per chunk, or one per partition
+    size_t offset;           // first row of the per-chunk loop
+    unsigned bits;           // partition bits
+    size_t *cursors;         // chunks x partitions
+    int *status;             // one per chunk
+    double *rows;            // partitioned rows: key, then the values
+    size_t *bounds;          // partition starts, partitions + 1
+} cgroup_job;
+
+// Entry of the final ordering
+typedef struct {
+    int64_t key;
+    const double *record;
+} cgroup_entry;
+
+static uint64_t fscl_group_hash(int64_t key) {
+    uint64_t x = (uint64_t)key;
+    x ^= x >> 30;
+    x *= 0xbf58476d1ce4e5b9ull;
+    x ^= x >> 27;
+    x *= 0x94d049bb133111ebull;
+    return x ^ (x >> 31);
+}
+
+// Function to convert a key: 1 for an integer, 0 for NaN, -1 otherwise
+static int fscl_group_key(double value, int64_t *key) {
+    if (isnan(value)) {
+        return 0;
+    }
+    if (!(value >= -9223372036854775808.0 && value < 9223372036854775808.0) || value != floor(value)) {
+        return -1;
+    }
+    *key = (int64_t)value;
+    return 1;
+}
+
+static void fscl_group_table_erase(cgroup_table *table) {
+    free(table->slots);
+    free(table->keys);
+    free(table->records);
+    memset(table, 0, sizeof(*table));
+}
+
+static int fscl_group_table_create(cgroup_table *table, size_t num_values, size_t expected) {
+    memset(table, 0, sizeof(*table));
+    table->width = 1 + 2 * num_values;
+
+    size_t slots = 16;
+    while (slots < expected * 2) {
+        slots <<= 1;
+    }
+    table->slots = (cgroup_slot *)malloc(slots * sizeof(cgroup_slot));
+    if (table->slots == NULL) {
+        table->status = FSCL_GROUP_NOMEM;
+        return -1;
+    }
+    for (size_t i = 0; i < slots; ++i) {
+        table->slots[i].group = FSCL_GROUP_EMPTY;
+    }
+    table->mask = slots - 1;
+    return 0;
+}
+
+// Function to double the slots and reinsert every group
+static int fscl_group_table_rehash(cgroup_table *table) {
+    size_t slots = (table->mask + 1) * 2;
+    cgroup_slot *grown = (cgroup_slot *)malloc(slots * sizeof(cgroup_slot));
+    if (grown == NULL) {
+        return -1;
+    }
+    for (size_t i = 0; i < slots; ++i) {
+        grown[i].group = FSCL_GROUP_EMPTY;
+    }
+    for (size_t g = 0; g < table->size; ++g) {
+        size_t i = fscl_group_hash(table->keys[g]) & (slots - 1);
+        while (grown[i].group != FSCL_GROUP_EMPTY) {
+            i = (i + 1) & (slots - 1);
+        }
+        grown[i].key = table->keys[g];
+        grown[i].group = g;
+    }
+    free(table->slots);
+    table->slots = grown;
+    table->mask = slots - 1;
+    return 0;
+}
+
+// Function to grow the key and record arrays
+static int fscl_group_table_reserve(cgroup_table *table) {
+    size_t allocated = table->allocated > 0 ? table->allocated * 2 : 64;
+
+    int64_t *keys = (int64_t *)realloc(table->keys, allocated * sizeof(int64_t));
+    if (keys != NULL) table->keys = keys;
+    double *records = (double *)realloc(table->records, allocated * table->width * sizeof(double));
+    if (records != NULL) table->records = records;
+
+    if (keys == NULL || records == NULL) {
+        return -1;
+    }
+    table->allocated = allocated;
+    return 0;
+}
+
+// Function to find the record of a key, adding an empty one if needed
+static double *fscl_group_table_find(cgroup_table *table, int64_t key) {
+    size_t i = fscl_group_hash(key) & table->mask;
+    while (table->slots[i].group != FSCL_GROUP_EMPTY) {
+        if (table->slots[i].key == key) {
+            return table->records + table->slots[i].group * table->width;
+        }
+        i = (i + 1) & table->mask;
+    }
+
+    // Keep the load factor at or below one half
+    if ((table->size + 1) * 2 > table->mask + 1) {
+        if (fscl_group_table_rehash(table) != 0) {
+            table->status = FSCL_GROUP_NOMEM;
+            return NULL;
+        }
+        i = fscl_group_hash(key) & table->mask;
+        while (table->slots[i].group != FSCL_GROUP_EMPTY) {
+            i = (i + 1) & table->mask;
+        }
+    }
+    if (table->size == table->allocated && fscl_group_table_reserve(table) != 0) {
+        table->status = FSCL_GROUP_NOMEM;
+        return NULL;
+    }
+
+    size_t g = table->size++;
+    table->slots[i].key = key;
+    table->slots[i].group = g;
+    table->keys[g] = key;
+    double *record = table->records + g * table->width;
+    memset(record, 0, table->width * sizeof(double));
+    return record;
+}
+
+// Function to add one value to a record
+static void fscl_group_accumulate(double *record, size_t v, double value) {
+    if (!isnan(value)) {
+        record[1 + 2 * v] += value;
+        record[2 + 2 * v] += 1.0;
+    }
+}
+
+// Function to fold the groups of one table into another
+static void fscl_group_table_merge(cgroup_table *table, const cgroup_table *other) {
+    for (size_t h = 0; h < other->size; ++h) {
+        double *record = fscl_group_table_find(table, other->keys[h]);
+        if (record == NULL) {
+            return;
+        }
+        const double *source = other->records + h * other->width;
+        for (size_t w = 0; w < table->width; ++w) {
+            record[w] += source[w];
+        }
+    }
+}
+
+// Function to aggregate the rows of one chunk into its own table
+static void fscl_group_local_chunk(void *context, size_t begin, size_t end) {
+    cgroup_job *job = (cgroup_job *)context;
+    int64_t key;
+
+    begin += job->offset;
+    end += job->offset;
+    cgroup_table *table = &job->tables[begin / FSCL_GROUP_CHUNK];
+    if (fscl_group_table_create(table, job->num_values, 256) != 0) {
+        return;
+    }
+    for (size_t row = begin; row < end; ++row) {
+        int kind = fscl_group_key(job->keys->data[row], &key);
+        if (kind < 0) {
+            table->status = FSCL_GROUP_BADKEY;
+            return;
+        }
+        if (kind > 0) {
+            double *record = fscl_group_table_find(table, key);
+            if (record == NULL) {
+                return;
+            }
+            record[0] += 1.0;
+            for (size_t v = 0; v < job->num_values; ++v) {
+                fscl_group_accumulate(record, v, job->values[v].data[row]);
+            }
+        }
+    }
+}
+
+// Function to count the rows of one chunk per partition
+static void fscl_group_histogram_chunk(void *context, size_t begin, size_t end) {
+    cgroup_job *job = (cgroup_job *)context;
+    size_t chunk = begin / FSCL_GROUP_CHUNK;
+    size_t *counts = job->cursors + (chunk << job->bits);
+    int64_t key;
+
+    for (size_t row = begin; row < end; ++row) {
+        int kind = fscl_group_key(job->keys->data[row], &key);
+        if (kind < 0) {
+            job->status[chunk] = FSCL_GROUP_BADKEY;
+            return;
+        }
+        if (kind > 0) {
+            counts[fscl_group_hash(key) >> (64 - job->bits)]++;
+        }
+    }
+}
+
+// Function to copy the rows of one chunk to their partitions, so every
+// partition is aggregated from one sequential buffer
+static void fscl_group_scatter_chunk(void *context, size_t begin, size_t end) {
+    cgroup_job *job = (cgroup_job *)context;
+    size_t *cursors = job->cursors + ((begin / FSCL_GROUP_CHUNK) << job->bits);
+    size_t width = 1 + job->num_values;
+    int64_t key;
+
+    for (size_t row = begin; row < end; ++row) {
+        if (fscl_group_key(job->keys->data[row], &key) > 0) {
+            double *slot = job->rows + cursors[fscl_group_hash(key) >> (64 - job->bits)]++ * width;
+            slot[0] = job->keys->data[row];
+            for (size_t v = 0; v < job->num_values; ++v) {
+                slot[1 + v] = job->values[v].data[row];
+            }
+        }
+    }
+}
+
+// Function to aggregate partitions
+static void fscl_group_partition_task(void *context, size_t begin, size_t end) {
+    cgroup_job *job = (cgroup_job *)context;
+    size_t width = 1 + job->num_values;
+
+    for (size_t p = begin; p < end; ++p) {
+        cgroup_table *table = &job->tables[p];
+        size_t first = job->bounds[p], last = job->bounds[p + 1];
+        if (fscl_group_table_create(table, job->num_values, (last - first) / 2) != 0) {
+            continue;
+        }
+        for (size_t r = first; r < last; ++r) {
+            const double *row = job->rows + r * width;
+            double *record = fscl_group_table_find(table, (int64_t)row[0]);
+            if (record == NULL) {
+                break;
+            }
+            record[0] += 1.0;
+            for (size_t v = 0; v < job->num_values; ++v) {
+                fscl_group_accumulate(record, v, row[1 + v]);
+            }
+        }
+    }
+}
+
+// Function to partition the rows and aggregate every partition
+static int fscl_group_partitioned(cgroup_job *job, size_t chunks) {
+    size_t size = job->keys->size;
+    size_t width = 1 + job->num_values;
+
+    job->bits = FSCL_GROUP_MIN_BITS;
+    while (job->bits < FSCL_GROUP_MAX_BITS && (size >> job->bits) > FSCL_GROUP_CHUNK) {
+        ++job->bits;
+    }
+    size_t parts = (size_t)1 << job->bits;
+
+    job->cursors = (size_t *)calloc(chunks * parts, sizeof(size_t));
+    job->status = (int *)calloc(chunks, sizeof(int));
+    job->bounds = (size_t *)malloc((parts + 1) * sizeof(size_t));
+    if (job->cursors == NULL || job->status == NULL || job->bounds == NULL) {
+        return FSCL_GROUP_NOMEM;
+    }
+
+    fscl_data_for(FSCL_DATA_EXEC_DEFAULT, size, FSCL_GROUP_CHUNK, fscl_group_histogram_chunk, job);
+    for (size_t c = 0; c < chunks; ++c) {
+        if (job->status[c] != 0) {
+            return job->status[c];
+        }
+    }
+
+    // Turn the counts into write cursors: partition-major, chunks in order,
+    // so every partition keeps its rows in their original order
+    size_t total = 0;
+    for (size_t p = 0; p < parts; ++p) {
+        job->bounds[p] = total;
+        for (size_t c = 0; c < chunks; ++c) {
+            size_t count = job->cursors[(c << job->bits) + p];
+            job->cursors[(c << job->bits) + p] = total;
+            total += count;
+        }
+    }
+    job->bounds[parts] = total;
+
+    job->rows = (double *)malloc((total > 0 ? total : 1) * width * sizeof(double));
+    job->tables = (cgroup_table *)calloc(parts, sizeof(cgroup_table));
+    if (job->rows == NULL || job->tables == NULL) {
+        return FSCL_GROUP_NOMEM;
+    }
+    fscl_data_for(FSCL_DATA_EXEC_DEFAULT, size, FSCL_GROUP_CHUNK, fscl_group_scatter_chunk, job);
+    fscl_data_for(FSCL_DATA_EXEC_DEFAULT, parts, 1, fscl_group_partition_task, job);
+
+    for (size_t p = 0; p < parts; ++p) {
+        if (job->tables[p].status != 0) {
+            return job->tables[p].status;
+        }
+    }
+    return 0;
+}
+
+// Function to sort entries by key: LSD radix over the bytes of the key
+// with the sign flipped, skipping bytes every key shares
+static void fscl_group_sort(cgroup_entry *entries, cgroup_entry *scratch, size_t count) {
+    size_t histogram[8][256];
+    memset(histogram, 0, sizeof(histogram));
+    for (size_t i = 0; i < count; ++i) {
+        uint64_t bits = (uint64_t)entries[i].key ^ 0x8000000000000000ull;
+        for (unsigned d = 0; d < 8; ++d) {
+            histogram[d][(bits >> (8 * d)) & 0xff]++;
+        }
+    }
+
+    cgroup_entry *from = entries, *to = scratch;
+    for (unsigned d = 0; d < 8; ++d) {
+        size_t total = 0;
+        int trivial = 0;
+        for (size_t b = 0; b < 256; ++b) {
+            size_t n = histogram[d][b];
+            trivial |= n == count;
+            histogram[d][b] = total;
+            total += n;
+        }
+        if (trivial) {
+            continue;
+        }
+        for (size_t i = 0; i < count; ++i) {
+            uint64_t bits = (uint64_t)from[i].key ^ 0x8000000000000000ull;
+            to[histogram[d][(bits >> (8 * d)) & 0xff]++] = from[i];
+        }
+        cgroup_entry *swap = from;
+        from = to;
+        to = swap;
+    }
+    if (from != entries) {
+        memcpy(entries, from, count * sizeof(cgroup_entry));
+    }
+}
+
+// Function to write the groups of the given tables, ordered by key
+static int fscl_group_output(const cgroup_table *tables, size_t num_tables, size_t num_values, cgroupby *result) {
+    size_t groups = 0;
+    for (size_t t = 0; t < num_tables; ++t) {
+        groups += tables[t].size;
+    }
+
+    cgroup_entry *entries = (cgroup_entry *)malloc((groups > 0 ? groups : 1) * 2 * sizeof(cgroup_entry));
+    result->sums = (cdataset *)calloc(num_values > 0 ? num_values : 1, sizeof(cdataset));
+    result->means = (cdataset *)calloc(num_values > 0 ? num_values : 1, sizeof(cdataset));
+    if (entries == NULL || result->sums == NULL || result->means == NULL) {
+        free(entries);
+        return -1;
+    }
+    result->num_values = num_values;
+
+    size_t n = 0;
+    for (size_t t = 0; t < num_tables; ++t) {
+        for (size_t g = 0; g < tables[t].size; ++g) {
+            entries[n].key = tables[t].keys[g];
+            entries[n].record = tables[t].records + g * tables[t].width;
+            ++n;
+        }
+    }
+    fscl_group_sort(entries, entries + groups, groups);
+
+    int failed = 0;
+    fscl_data_create(&result->keys, groups);
+    fscl_data_create(&result->counts, groups);
+    failed |= result->keys.data == NULL || result->counts.data == NULL;
+    for (size_t v = 0; v < num_values; ++v) {
+        fscl_data_create(&result->sums[v], groups);
+        fscl_data_create(&result->means[v], groups);
+        failed |= result->sums[v].data == NULL || result->means[v].data == NULL;
+    }
+    if (failed && groups > 0) {
+        free(entries);
+        return -1;
+    }
+
+    for (size_t i = 0; i < groups; ++i) {
+        const double *record = entries[i].record;
+        result->keys.data[i] = (double)entries[i].key;
+        result->counts.data[i] = record[0];
+        for (size_t v = 0; v < num_values; ++v) {
+            double sum = record[1 + 2 * v];
+            double valid = record[2 + 2 * v];
+            result->sums[v].data[i] = sum;
+            result->means[v].data[i] = valid > 0.0 ? sum / valid : NAN;
+        }
+    }
+    free(entries);
+    return 0;
+}
+
+// Function to aggregate value datasets per distinct key
+int fscl_data_group_by(const cdataset *keys, const cdataset *values, size_t num_values, cgroupby *result) {
+    memset(result, 0, sizeof(*result));
+    for (size_t v = 0; v < num_values; ++v) {
+        if (values[v].size != keys->size) {
+            fprintf(stderr, "Error: Key and value datasets must have the same size\n");
+            return -1;
+        }
+    }
+
+    size_t size = keys->size;
+    size_t chunks = (size + FSCL_GROUP_CHUNK - 1) / FSCL_GROUP_CHUNK;
+    cgroup_job job;
+    memset(&job, 0, sizeof(job));
+    job.keys = keys;
+    job.values = values;
+    job.num_values = num_values;
+
+    // The first chunk decides: few keys get one table per chunk
+    int status = 0;
+    size_t num_tables = 0;
+    job.tables = (cgroup_table *)calloc(chunks > 0 ? chunks : 1, sizeof(cgroup_table));
+    if (job.tables == NULL) {
+        status = FSCL_GROUP_NOMEM;
+    } else if (chunks > 0) {
+        fscl_group_local_chunk(&job, 0, size < FSCL_GROUP_CHUNK ? size : FSCL_GROUP_CHUNK);
+        status = job.tables[0].status;
+        num_tables = 1;
+
+        if (status == 0 && job.tables[0].size <= FSCL_GROUP_SMALL) {
+            if (chunks > 1) {
+                // The first chunk is done; the loop covers the rest
+                job.offset = FSCL_GROUP_CHUNK;
+                fscl_data_for(FSCL_DATA_EXEC_DEFAULT, size - FSCL_GROUP_CHUNK, FSCL_GROUP_CHUNK, fscl_group_local_chunk, &job);
+                for (size_t c = 1; c < chunks && status == 0; ++c) {
+                    status = job.tables[c].status;
+                    if (status == 0) {
+                        fscl_group_table_merge(&job.tables[0], &job.tables[c]);
+                        status = job.tables[0].status;
+                    }
+                }
+            }
+            for (size_t c = 1; c < chunks; ++c) {
+                fscl_group_table_erase(&job.tables[c]);
+            }
+        } else if (status == 0) {
+            fscl_group_table_erase(&job.tables[0]);
+            free(job.tables);
+            job.tables = NULL;
+            status = fscl_group_partitioned(&job, chunks);
+            num_tables = (size_t)1 << job.bits;
+        }
+    }
+
+    if (status == 0 && fscl_group_output(job.tables, job.tables != NULL ? num_tables : 0, num_values, result) != 0) {
+        status = FSCL_GROUP_NOMEM;
+    }
+
+    if (job.tables != NULL) {
+        for (size_t t = 0; t < num_tables; ++t) {
+            fscl_group_table_erase(&job.tables[t]);
+        }
+        free(job.tables);
+    }
+    free(job.cursors);
+    free(job.status);
+    free(job.rows);
+    free(job.bounds);
+
+    if (status != 0) {
+        fscl_group_by_erase(result);
+        if (status == FSCL_GROUP_BADKEY) {
+            fprintf(stderr, "Error: Group-by keys must be integers\n");
+        } else {
+            fprintf(stderr, "Error: Memory allocation failed\n");
+        }
+        return -1;
+    }
+    return 0;
+}
+
+// Function to erase a group-by result
+void fscl_group_by_erase(cgroupby *result) {
+    fscl_data_erase(&result->keys);
+    fscl_data_erase(&result->counts);
+    for (size_t v = 0; v < result->num_values; ++v) {
+        fscl_data_erase(&result->sums[v]);
+        fscl_data_erase(&result->means[v]);
+    }
+    free(result->sums);
+    free(result->means);
+    memset(result, 0, sizeof(*result));
+}
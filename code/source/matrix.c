@@ -0,0 +1,720 @@
+/*
+==============================================================================
+Author: Michael Gene Brockus (Dreamer)
+Email: michaelbrockus@gmail.com
+Organization: Fossil Logic
+Description: 
+    This file is part of the Fossil Logic project, where innovation meets
+    excellence in software development. Michael Gene Brockus, also known as
+    "Dreamer," is a dedicated contributor to this project. For any inquiries,
+    feel free to contact Michael at michaelbrockus@gmail.com.
+==============================================================================
+*/
+#include "fossil/xscience/matrix.h"
+#include "fossil/xscience/parallel.h"
+#include <string.h>
+
+// Packing buffers are cache-line aligned; Windows has no aligned_alloc
+#if defined(_WIN32)
+#include <malloc.h>
+#define fscl_matrix_alloc(bytes) _aligned_malloc(bytes, 64)
+#define fscl_matrix_free(pointer) _aligned_free(pointer)
+#else
+#define fscl_matrix_alloc(bytes) aligned_alloc(64, ((bytes) + 63) / 64 * 64)
+#define fscl_matrix_free(pointer) free(pointer)
+#endif
+
+#if defined(__x86_64__) || defined(_M_X64) || defined(__i386__) || defined(_M_IX86)
+#define FSCL_MATRIX_X86
+#include <immintrin.h>
+#if defined(_MSC_VER) && !defined(__clang__)
+#define FSCL_MATRIX_TARGET(isa)
+#else
+#define FSCL_MATRIX_TARGET(isa) __attribute__((target(isa)))
+#endif
+#endif
+
+// Register tile of the GEMM microkernel: MR rows by NR columns of C,
+// twelve AVX2 accumulators
+#define FSCL_MATRIX_MR 6
+#define FSCL_MATRIX_NR 8
+
+// Cache blocks: a KC x NR panel of B stays in L1, an MC x KC block of A
+// in L2 and a KC x NC panel of B in L3
+#define FSCL_MATRIX_KC 256
+#define FSCL_MATRIX_MC 96
+#define FSCL_MATRIX_NC 2048
+
+// GEMV: columns per block (the slice of x stays in L1) and rows per chunk
+#define FSCL_MATRIX_GEMV_BLOCK 2048
+#define FSCL_MATRIX_GEMV_ROWS 512
+
+// Columns per block of the covariance Gram matrix
+#define FSCL_MATRIX_GRAM_BLOCK 64
+
+// Products below this many multiply-adds stay on the calling thread
+#define FSCL_MATRIX_SERIAL ((size_t)1 << 18)
+
+// sums[r] += row r of a (rows `stride` apart) dotted with x, for 4 rows
+typedef void (*cmatrix_dot4)(const double *a, size_t stride, const double *x, size_t n, double *sums);
+
+// y[i] += sum of a[c * stride + i] * x[c] over 4 columns c
+typedef void (*cmatrix_axpy4)(const double *a, size_t stride, const double *x, size_t n, double *y);
+
+// tile = packed MR x kc panel of A times packed kc x NR panel of B
+typedef void (*cmatrix_tile)(size_t kc, const double *a, const double *b, double *tile);
+
+typedef struct {
+    cmatrix_dot4 dot4;
+    cmatrix_axpy4 axpy4;
+    cmatrix_tile tile;
+} cmatrix_kernels;
+
+typedef struct {
+    double alpha;
+    double beta;
+    const double *a;
+    size_t rs, cs;
+    size_t cols;
+    const double *x;
+    double *y;
+    const cmatrix_kernels *kernels;
+} cmatrix_gemv_job;
+
+typedef struct {
+    double alpha;
+    const double *a;
+    size_t ars, acs;
+    const double *packed_b;
+    double *packed_a;        // one block of A per chunk
+    size_t packed_a_size;    // doubles per block of A
+    double *c;
+    size_t crs, ccs;
+    size_t grain;
+    size_t kc, jc, nc;
+    cmatrix_tile tile;
+} cmatrix_gemm_job;
+
+typedef struct {
+    const cdataset *columns;
+    double *centered;        // column-major rows x num_columns
+    size_t rows;
+    size_t num_columns;
+    double *result;
+    size_t *pairs;           // block pairs (row block, column block), upper triangle
+    size_t grain;            // block pairs per chunk
+    double *packing;         // packing buffers for A and B, one pair per chunk
+    size_t packing_size;     // doubles per chunk of packing
+} cmatrix_gram_job;
+
+// Function to get the strides of element (i, j) = data[i * rs + j * cs]
+static void fscl_matrix_strides(const cmatrix *matrix, size_t *rs, size_t *cs) {
+    if (matrix->layout == FSCL_MATRIX_ROW_MAJOR) {
+        *rs = matrix->stride;
+        *cs = 1;
+    } else {
+        *rs = 1;
+        *cs = matrix->stride;
+    }
+}
+
+// =================================================================
+// Kernels
+// =================================================================
+
+static void fscl_matrix_dot4_scalar(const double *a, size_t stride, const double *x, size_t n, double *sums) {
+    const double *a0 = a, *a1 = a + stride, *a2 = a + 2 * stride, *a3 = a + 3 * stride;
+    double s0 = 0.0, s1 = 0.0, s2 = 0.0, s3 = 0.0;
+    for (size_t i = 0; i < n; ++i) {
+        double xi = x[i];
+        s0 += a0[i] * xi;
+        s1 += a1[i] * xi;
+        s2 += a2[i] * xi;
+        s3 += a3[i] * xi;
+    }
+    sums[0] += s0;
+    sums[1] += s1;
+    sums[2] += s2;
+    sums[3] += s3;
+}
+
+static void fscl_matrix_axpy4_scalar(const double *a, size_t stride, const double *x, size_t n, double *y) {
+    const double *a0 = a, *a1 = a + stride, *a2 = a + 2 * stride, *a3 = a + 3 * stride;
+    double x0 = x[0], x1 = x[1], x2 = x[2], x3 = x[3];
+    for (size_t i = 0; i < n; ++i) {
+        y[i] += a0[i] * x0 + a1[i] * x1 + a2[i] * x2 + a3[i] * x3;
+    }
+}
+
+static void fscl_matrix_tile_scalar(size_t kc, const double *a, const double *b, double *tile) {
+    double acc[FSCL_MATRIX_MR * FSCL_MATRIX_NR] = {0.0};
+    for (size_t p = 0; p < kc; ++p) {
+        for (size_t r = 0; r < FSCL_MATRIX_MR; ++r) {
+            double ar = a[r];
+            for (size_t c = 0; c < FSCL_MATRIX_NR; ++c) {
+                acc[r * FSCL_MATRIX_NR + c] += ar * b[c];
+            }
+        }
+        a += FSCL_MATRIX_MR;
+        b += FSCL_MATRIX_NR;
+    }
+    memcpy(tile, acc, sizeof(acc));
+}
+
+#ifdef FSCL_MATRIX_X86
+FSCL_MATRIX_TARGET("avx2,fma")
+static void fscl_matrix_dot4_avx2(const double *a, size_t stride, const double *x, size_t n, double *sums) {
+    const double *a0 = a, *a1 = a + stride, *a2 = a + 2 * stride, *a3 = a + 3 * stride;
+    __m256d s0 = _mm256_setzero_pd(), s1 = _mm256_setzero_pd();
+    __m256d s2 = _mm256_setzero_pd(), s3 = _mm256_setzero_pd();
+    size_t i = 0;
+    for (; i + 4 <= n; i += 4) {
+        __m256d xv = _mm256_loadu_pd(x + i);
+        s0 = _mm256_fmadd_pd(_mm256_loadu_pd(a0 + i), xv, s0);
+        s1 = _mm256_fmadd_pd(_mm256_loadu_pd(a1 + i), xv, s1);
+        s2 = _mm256_fmadd_pd(_mm256_loadu_pd(a2 + i), xv, s2);
+        s3 = _mm256_fmadd_pd(_mm256_loadu_pd(a3 + i), xv, s3);
+    }
+
+    // Reduce the four accumulators into one vector of four row sums
+    __m256d h01 = _mm256_hadd_pd(s0, s1);
+    __m256d h23 = _mm256_hadd_pd(s2, s3);
+    __m256d total = _mm256_add_pd(_mm256_permute2f128_pd(h01, h23, 0x20), _mm256_permute2f128_pd(h01, h23, 0x31));
+    total = _mm256_add_pd(total, _mm256_loadu_pd(sums));
+    _mm256_storeu_pd(sums, total);
+
+    for (; i < n; ++i) {
+        sums[0] += a0[i] * x[i];
+        sums[1] += a1[i] * x[i];
+        sums[2] += a2[i] * x[i];
+        sums[3] += a3[i] * x[i];
+    }
+}
+
+FSCL_MATRIX_TARGET("avx2,fma")
+static void fscl_matrix_axpy4_avx2(const double *a, size_t stride, const double *x, size_t n, double *y) {
+    const double *a0 = a, *a1 = a + stride, *a2 = a + 2 * stride, *a3 = a + 3 * stride;
+    __m256d x0 = _mm256_set1_pd(x[0]), x1 = _mm256_set1_pd(x[1]);
+    __m256d x2 = _mm256_set1_pd(x[2]), x3 = _mm256_set1_pd(x[3]);
+    size_t i = 0;
+    for (; i + 4 <= n; i += 4) {
+        __m256d sum = _mm256_mul_pd(_mm256_loadu_pd(a0 + i), x0);
+        sum = _mm256_fmadd_pd(_mm256_loadu_pd(a1 + i), x1, sum);
+        sum = _mm256_fmadd_pd(_mm256_loadu_pd(a2 + i), x2, sum);
+        sum = _mm256_fmadd_pd(_mm256_loadu_pd(a3 + i), x3, sum);
+        _mm256_storeu_pd(y + i, _mm256_add_pd(_mm256_loadu_pd(y + i), sum));
+    }
+    for (; i < n; ++i) {
+        y[i] += a0[i] * x[0] + a1[i] * x[1] + a2[i] * x[2] + a3[i] * x[3];
+    }
+}
+
+FSCL_MATRIX_TARGET("avx2,fma")
+static void fscl_matrix_tile_avx2(size_t kc, const double *a, const double *b, double *tile) {
+    __m256d c00 = _mm256_setzero_pd(), c01 = _mm256_setzero_pd();
+    __m256d c10 = _mm256_setzero_pd(), c11 = _mm256_setzero_pd();
+    __m256d c20 = _mm256_setzero_pd(), c21 = _mm256_setzero_pd();
+    __m256d c30 = _mm256_setzero_pd(), c31 = _mm256_setzero_pd();
+    __m256d c40 = _mm256_setzero_pd(), c41 = _mm256_setzero_pd();
+    __m256d c50 = _mm256_setzero_pd(), c51 = _mm256_setzero_pd();
+
+    for (size_t p = 0; p < kc; ++p) {
+        __m256d b0 = _mm256_loadu_pd(b), b1 = _mm256_loadu_pd(b + 4);
+        __m256d av;
+        av = _mm256_broadcast_sd(a + 0);
+        c00 = _mm256_fmadd_pd(av, b0, c00);
+        c01 = _mm256_fmadd_pd(av, b1, c01);
+        av = _mm256_broadcast_sd(a + 1);
+        c10 = _mm256_fmadd_pd(av, b0, c10);
+        c11 = _mm256_fmadd_pd(av, b1, c11);
+        av = _mm256_broadcast_sd(a + 2);
+        c20 = _mm256_fmadd_pd(av, b0, c20);
+        c21 = _mm256_fmadd_pd(av, b1, c21);
+        av = _mm256_broadcast_sd(a + 3);
+        c30 = _mm256_fmadd_pd(av, b0, c30);
+        c31 = _mm256_fmadd_pd(av, b1, c31);
+        av = _mm256_broadcast_sd(a + 4);
+        c40 = _mm256_fmadd_pd(av, b0, c40);
+        c41 = _mm256_fmadd_pd(av, b1, c41);
+        av = _mm256_broadcast_sd(a + 5);
+        c50 = _mm256_fmadd_pd(av, b0, c50);
+        c51 = _mm256_fmadd_pd(av, b1, c51);
+        a += FSCL_MATRIX_MR;
+        b += FSCL_MATRIX_NR;
+    }
+
+    _mm256_storeu_pd(tile + 0, c00);
+    _mm256_storeu_pd(tile + 4, c01);
+    _mm256_storeu_pd(tile + 8, c10);
+    _mm256_storeu_pd(tile + 12, c11);
+    _mm256_storeu_pd(tile + 16, c20);
+    _mm256_storeu_pd(tile + 20, c21);
+    _mm256_storeu_pd(tile + 24, c30);
+    _mm256_storeu_pd(tile + 28, c31);
+    _mm256_storeu_pd(tile + 32, c40);
+    _mm256_storeu_pd(tile + 36, c41);
+    _mm256_storeu_pd(tile + 40, c50);
+    _mm256_storeu_pd(tile + 44, c51);
+}
+#endif
+
+static const cmatrix_kernels fscl_matrix_scalar_kernels = {
+    fscl_matrix_dot4_scalar, fscl_matrix_axpy4_scalar, fscl_matrix_tile_scalar
+};
+
+#ifdef FSCL_MATRIX_X86
+static const cmatrix_kernels fscl_matrix_avx2_kernels = {
+    fscl_matrix_dot4_avx2, fscl_matrix_axpy4_avx2, fscl_matrix_tile_avx2
+};
+#endif
+
+// Function to pick the kernels for the SIMD level of the CPU
+static const cmatrix_kernels *fscl_matrix_kernels(void) {
+#ifdef FSCL_MATRIX_X86
+    if (fscl_data_simd_level() >= FSCL_DATA_SIMD_AVX2) {
+        return &fscl_matrix_avx2_kernels;
+    }
+#endif
+    return &fscl_matrix_scalar_kernels;
+}
+
+// Function to run a task on the pool unless the work is small or the
+// policy is serial
+static void fscl_matrix_run(size_t count, size_t grain, size_t work, cparallel_task task, void *context) {
+    cdataset_exec policy = work >= FSCL_MATRIX_SERIAL ? FSCL_DATA_EXEC_DEFAULT : FSCL_DATA_EXEC_SERIAL;
+    fscl_data_for(policy, count, grain, task, context);
+}
+
+// =================================================================
+// Views
+// =================================================================
+
+// Function to view a dataset as a matrix
+int fscl_matrix_view(cmatrix *matrix, const cdataset *dataset, size_t rows, size_t cols, cmatrix_layout layout) {
+    if (cols != 0 && rows > dataset->size / cols) {
+        fprintf(stderr, "Error: Dataset is too small for the matrix\n");
+        return -1;
+    }
+    matrix->data = dataset->data;
+    matrix->rows = rows;
+    matrix->cols = cols;
+    matrix->stride = layout == FSCL_MATRIX_ROW_MAJOR ? cols : rows;
+    matrix->layout = layout;
+    return 0;
+}
+
+// Function to view a block of a matrix
+int fscl_matrix_block(cmatrix *block, const cmatrix *matrix, size_t row, size_t col, size_t rows, size_t cols) {
+    if (row > matrix->rows || rows > matrix->rows - row || col > matrix->cols || cols > matrix->cols - col) {
+        fprintf(stderr, "Error: Block does not fit in the matrix\n");
+        return -1;
+    }
+    size_t rs, cs;
+    fscl_matrix_strides(matrix, &rs, &cs);
+    block->data = matrix->data + row * rs + col * cs;
+    block->rows = rows;
+    block->cols = cols;
+    block->stride = matrix->stride;
+    block->layout = matrix->layout;
+    return 0;
+}
+
+// Function to view the transpose of a matrix
+void fscl_matrix_transpose(cmatrix *matrix) {
+    size_t rows = matrix->rows;
+    matrix->rows = matrix->cols;
+    matrix->cols = rows;
+    matrix->layout = matrix->layout == FSCL_MATRIX_ROW_MAJOR ? FSCL_MATRIX_COL_MAJOR : FSCL_MATRIX_ROW_MAJOR;
+}
+
+// Function to get one element
+double fscl_matrix_get(const cmatrix *matrix, size_t row, size_t col) {
+    size_t rs, cs;
+    fscl_matrix_strides(matrix, &rs, &cs);
+    return matrix->data[row * rs + col * cs];
+}
+
+// =================================================================
+// GEMV
+// =================================================================
+
+// Function to store alpha * sums + beta * y for a run of rows
+static void fscl_matrix_gemv_store(const cmatrix_gemv_job *job, const double *sums, size_t begin, size_t end) {
+    for (size_t r = begin; r < end; ++r) {
+        double value = job->alpha * sums[r - begin];
+        job->y[r] = job->beta == 0.0 ? value : value + job->beta * job->y[r];
+    }
+}
+
+// Function to multiply a chunk of rows of a row-major matrix: dot products
+// of four rows at a time against one L1-sized slice of x
+static void fscl_matrix_gemv_rows(void *context, size_t begin, size_t end) {
+    cmatrix_gemv_job *job = (cmatrix_gemv_job *)context;
+    double sums[FSCL_MATRIX_GEMV_ROWS] = {0.0};
+
+    for (size_t block = 0; block < job->cols; block += FSCL_MATRIX_GEMV_BLOCK) {
+        size_t n = job->cols - block < FSCL_MATRIX_GEMV_BLOCK ? job->cols - block : FSCL_MATRIX_GEMV_BLOCK;
+        const double *x = job->x + block;
+        size_t r = begin;
+        for (; r + 4 <= end; r += 4) {
+            job->kernels->dot4(job->a + r * job->rs + block, job->rs, x, n, sums + (r - begin));
+        }
+        for (; r < end; ++r) {
+            const double *row = job->a + r * job->rs + block;
+            double sum = 0.0;
+            for (size_t i = 0; i < n; ++i) {
+                sum += row[i] * x[i];
+            }
+            sums[r - begin] += sum;
+        }
+    }
+    fscl_matrix_gemv_store(job, sums, begin, end);
+}
+
+// Function to multiply a chunk of rows of a column-major matrix: the
+// chunk of y stays in L1 while four columns at a time are added in
+static void fscl_matrix_gemv_cols(void *context, size_t begin, size_t end) {
+    cmatrix_gemv_job *job = (cmatrix_gemv_job *)context;
+    double sums[FSCL_MATRIX_GEMV_ROWS] = {0.0};
+    size_t n = end - begin;
+
+    size_t c = 0;
+    for (; c + 4 <= job->cols; c += 4) {
+        job->kernels->axpy4(job->a + c * job->cs + begin, job->cs, job->x + c, n, sums);
+    }
+    for (; c < job->cols; ++c) {
+        const double *col = job->a + c * job->cs + begin;
+        for (size_t i = 0; i < n; ++i) {
+            sums[i] += col[i] * job->x[c];
+        }
+    }
+    fscl_matrix_gemv_store(job, sums, begin, end);
+}
+
+// Function to compute y = alpha * A * x + beta * y
+int fscl_matrix_gemv(double alpha, const cmatrix *a, const cdataset *x, double beta, cdataset *y) {
+    if (x->size != a->cols || y->size != a->rows) {
+        fprintf(stderr, "Error: Vector sizes must match the matrix\n");
+        return -1;
+    }
+
+    cmatrix_gemv_job job = {alpha, beta, a->data, 0, 0, a->cols, x->data, y->data, fscl_matrix_kernels()};
+    fscl_matrix_strides(a, &job.rs, &job.cs);
+    cparallel_task task = job.cs == 1 ? fscl_matrix_gemv_rows : fscl_matrix_gemv_cols;
+    fscl_matrix_run(a->rows, FSCL_MATRIX_GEMV_ROWS, a->rows * a->cols, task, &job);
+    return 0;
+}
+
+// =================================================================
+// GEMM
+// =================================================================
+
+// Function to pack an mc x kc block of A into MR-row panels, each stored
+// column by column and padded with zeros
+static void fscl_matrix_pack_a(const double *a, size_t rs, size_t cs, size_t mc, size_t kc, double *packed) {
+    for (size_t ir = 0; ir < mc; ir += FSCL_MATRIX_MR) {
+        size_t mr = mc - ir < FSCL_MATRIX_MR ? mc - ir : FSCL_MATRIX_MR;
+        const double *panel = a + ir * rs;
+        for (size_t p = 0; p < kc; ++p) {
+            size_t r = 0;
+            for (; r < mr; ++r) {
+                *packed++ = panel[r * rs + p * cs];
+            }
+            for (; r < FSCL_MATRIX_MR; ++r) {
+                *packed++ = 0.0;
+            }
+        }
+    }
+}
+
+// Function to pack a kc x nc panel of B into NR-column panels, each
+// stored row by row and padded with zeros
+static void fscl_matrix_pack_b(const double *b, size_t rs, size_t cs, size_t kc, size_t nc, double *packed) {
+    for (size_t jr = 0; jr < nc; jr += FSCL_MATRIX_NR) {
+        size_t nr = nc - jr < FSCL_MATRIX_NR ? nc - jr : FSCL_MATRIX_NR;
+        const double *panel = b + jr * cs;
+        for (size_t p = 0; p < kc; ++p) {
+            size_t c = 0;
+            for (; c < nr; ++c) {
+                *packed++ = panel[p * rs + c * cs];
+            }
+            for (; c < FSCL_MATRIX_NR; ++c) {
+                *packed++ = 0.0;
+            }
+        }
+    }
+}
+
+// Function to multiply a chunk of rows of A by the packed panel of B
+static void fscl_matrix_gemm_chunk(void *context, size_t begin, size_t end) {
+    cmatrix_gemm_job *job = (cmatrix_gemm_job *)context;
+    double *packed_a = job->packed_a + (begin / job->grain) * job->packed_a_size;
+    double tile[FSCL_MATRIX_MR * FSCL_MATRIX_NR];
+
+    for (size_t ic = begin; ic < end; ic += FSCL_MATRIX_MC) {
+        size_t mc = end - ic < FSCL_MATRIX_MC ? end - ic : FSCL_MATRIX_MC;
+        fscl_matrix_pack_a(job->a + ic * job->ars, job->ars, job->acs, mc, job->kc, packed_a);
+
+        // Each NR panel of B stays in L1 while the MR panels of A stream by
+        for (size_t jr = 0; jr < job->nc; jr += FSCL_MATRIX_NR) {
+            size_t nr = job->nc - jr < FSCL_MATRIX_NR ? job->nc - jr : FSCL_MATRIX_NR;
+            for (size_t ir = 0; ir < mc; ir += FSCL_MATRIX_MR) {
+                size_t mr = mc - ir < FSCL_MATRIX_MR ? mc - ir : FSCL_MATRIX_MR;
+                job->tile(job->kc, packed_a + ir * job->kc, job->packed_b + jr * job->kc, tile);
+
+                double *c = job->c + (ic + ir) * job->crs + (job->jc + jr) * job->ccs;
+                for (size_t r = 0; r < mr; ++r) {
+                    for (size_t k = 0; k < nr; ++k) {
+                        c[r * job->crs + k * job->ccs] += job->alpha * tile[r * FSCL_MATRIX_NR + k];
+                    }
+                }
+            }
+        }
+    }
+}
+
+// Function to get the doubles one packed block of A needs for an m x k product
+static size_t fscl_matrix_packed_a_size(size_t m, size_t k) {
+    size_t mc = m < FSCL_MATRIX_MC ? m : FSCL_MATRIX_MC;
+    size_t kc = k < FSCL_MATRIX_KC ? k : FSCL_MATRIX_KC;
+    return (mc + FSCL_MATRIX_MR - 1) / FSCL_MATRIX_MR * FSCL_MATRIX_MR * kc;
+}
+
+// Function to get the doubles the packed panel of B needs for a k x n product
+static size_t fscl_matrix_packed_b_size(size_t n, size_t k) {
+    size_t nc = n < FSCL_MATRIX_NC ? n : FSCL_MATRIX_NC;
+    size_t kc = k < FSCL_MATRIX_KC ? k : FSCL_MATRIX_KC;
+    return (nc + FSCL_MATRIX_NR - 1) / FSCL_MATRIX_NR * FSCL_MATRIX_NR * kc;
+}
+
+// Function to get the rows of C per chunk when the product runs on `threads`
+// threads: one contiguous run of MC blocks each, so every element of C still
+// sums its products in the same order
+static size_t fscl_matrix_gemm_grain(size_t m, size_t threads) {
+    size_t blocks = (m + FSCL_MATRIX_MC - 1) / FSCL_MATRIX_MC;
+    return (blocks + threads - 1) / threads * FSCL_MATRIX_MC;
+}
+
+// Function to compute C = alpha * A * B + beta * C into buffers the caller
+// sized: one packed block of A per chunk of `grain` rows and one panel of B
+static void fscl_matrix_gemm_packed(double alpha, const cmatrix *a, const cmatrix *b, double beta, cmatrix *c,
+                                    size_t grain, double *packed_a, double *packed_b) {
+    size_t m = a->rows, n = b->cols, k = a->cols;
+    size_t brs, bcs;
+    cmatrix_gemm_job job;
+    memset(&job, 0, sizeof(job));
+    job.alpha = alpha;
+    job.c = c->data;
+    job.grain = grain;
+    job.packed_a = packed_a;
+    job.packed_a_size = fscl_matrix_packed_a_size(m, k);
+    job.packed_b = packed_b;
+    job.tile = fscl_matrix_kernels()->tile;
+    fscl_matrix_strides(a, &job.ars, &job.acs);
+    fscl_matrix_strides(b, &brs, &bcs);
+    fscl_matrix_strides(c, &job.crs, &job.ccs);
+
+    for (size_t i = 0; i < m; ++i) {
+        for (size_t j = 0; j < n; ++j) {
+            double *value = &c->data[i * job.crs + j * job.ccs];
+            *value = beta == 0.0 ? 0.0 : *value * beta;
+        }
+    }
+    if (m == 0 || n == 0 || k == 0 || alpha == 0.0) {
+        return;
+    }
+
+    size_t work = grain < m ? m * n * k : 0;
+    for (size_t jc = 0; jc < n; jc += FSCL_MATRIX_NC) {
+        job.jc = jc;
+        job.nc = n - jc < FSCL_MATRIX_NC ? n - jc : FSCL_MATRIX_NC;
+        for (size_t pc = 0; pc < k; pc += FSCL_MATRIX_KC) {
+            job.kc = k - pc < FSCL_MATRIX_KC ? k - pc : FSCL_MATRIX_KC;
+            fscl_matrix_pack_b(b->data + pc * brs + jc * bcs, brs, bcs, job.kc, job.nc, packed_b);
+            job.a = a->data + pc * job.acs;
+            fscl_matrix_run(m, grain, work, fscl_matrix_gemm_chunk, &job);
+        }
+    }
+}
+
+// Function to compute C = alpha * A * B + beta * C
+int fscl_matrix_gemm(double alpha, const cmatrix *a, const cmatrix *b, double beta, cmatrix *c) {
+    if (a->cols != b->rows || c->rows != a->rows || c->cols != b->cols) {
+        fprintf(stderr, "Error: Matrix sizes do not match\n");
+        return -1;
+    }
+
+    size_t m = a->rows, n = b->cols, k = a->cols;
+    size_t threads = 1;
+    if (m * n * k >= FSCL_MATRIX_SERIAL && fscl_data_parallel(FSCL_DATA_EXEC_DEFAULT)) {
+        threads = fscl_parallel_get_threads();
+    }
+    size_t grain = fscl_matrix_gemm_grain(m, threads);
+
+    // Size the buffers to the product, not to the cache blocks
+    double *packed_a = NULL, *packed_b = NULL;
+    if (m != 0 && n != 0 && k != 0 && alpha != 0.0) {
+        size_t chunks = (m + grain - 1) / grain;
+        packed_a = (double *)fscl_matrix_alloc(chunks * fscl_matrix_packed_a_size(m, k) * sizeof(double));
+        packed_b = (double *)fscl_matrix_alloc(fscl_matrix_packed_b_size(n, k) * sizeof(double));
+        if (packed_a == NULL || packed_b == NULL) {
+            fprintf(stderr, "Error: Memory allocation failed\n");
+            fscl_matrix_free(packed_a);
+            fscl_matrix_free(packed_b);
+            return -1;
+        }
+    }
+
+    fscl_matrix_gemm_packed(alpha, a, b, beta, c, grain, packed_a, packed_b);
+    fscl_matrix_free(packed_a);
+    fscl_matrix_free(packed_b);
+    return 0;
+}
+
+// =================================================================
+// Covariance
+// =================================================================
+
+// Function to copy columns into the centered buffer
+static void fscl_matrix_center_columns(void *context, size_t begin, size_t end) {
+    cmatrix_gram_job *job = (cmatrix_gram_job *)context;
+    for (size_t j = begin; j < end; ++j) {
+        const double *source = job->columns[j].data;
+        double *target = job->centered + j * job->rows;
+        double sum = 0.0;
+        for (size_t i = 0; i < job->rows; ++i) {
+            sum += source[i];
+        }
+        double mean = sum / (double)job->rows;
+        for (size_t i = 0; i < job->rows; ++i) {
+            target[i] = source[i] - mean;
+        }
+    }
+}
+
+// Function to compute blocks of the upper triangle of the Gram matrix
+static void fscl_matrix_gram_blocks(void *context, size_t begin, size_t end) {
+    cmatrix_gram_job *job = (cmatrix_gram_job *)context;
+    cdataset storage = {job->centered, job->rows * job->num_columns, NULL};
+    cdataset output = {job->result, job->num_columns * job->num_columns, NULL};
+    cmatrix centered, result, left, right, block;
+
+    // Every pair of the chunk reuses the chunk's packing buffers
+    double *packed_a = job->packing + (begin / job->grain) * job->packing_size;
+    double *packed_b = packed_a + fscl_matrix_packed_a_size(FSCL_MATRIX_GRAM_BLOCK, job->rows);
+
+    fscl_matrix_view(&centered, &storage, job->rows, job->num_columns, FSCL_MATRIX_COL_MAJOR);
+    fscl_matrix_view(&result, &output, job->num_columns, job->num_columns, FSCL_MATRIX_ROW_MAJOR);
+    for (size_t p = begin; p < end; ++p) {
+        size_t ib = job->pairs[2 * p], jb = job->pairs[2 * p + 1];
+        size_t ni = job->num_columns - ib < FSCL_MATRIX_GRAM_BLOCK ? job->num_columns - ib : FSCL_MATRIX_GRAM_BLOCK;
+        size_t nj = job->num_columns - jb < FSCL_MATRIX_GRAM_BLOCK ? job->num_columns - jb : FSCL_MATRIX_GRAM_BLOCK;
+
+        fscl_matrix_block(&left, &centered, 0, ib, job->rows, ni);
+        fscl_matrix_transpose(&left);
+        fscl_matrix_block(&right, &centered, 0, jb, job->rows, nj);
+        fscl_matrix_block(&block, &result, ib, jb, ni, nj);
+        fscl_matrix_gemm_packed(1.0 / (double)job->rows, &left, &right, 0.0, &block,
+                                fscl_matrix_gemm_grain(ni, 1), packed_a, packed_b);
+    }
+}
+
+// Function to compute the covariance matrix of a set of columns
+int fscl_data_covariance_matrix(const cdataset *columns, size_t num_columns, cdataset *result) {
+    memset(result, 0, sizeof(*result));
+    if (num_columns == 0 || columns[0].size == 0) {
+        fprintf(stderr, "Error: Covariance needs at least one non-empty column\n");
+        return -1;
+    }
+    size_t rows = columns[0].size;
+    for (size_t j = 1; j < num_columns; ++j) {
+        if (columns[j].size != rows) {
+            fprintf(stderr, "Error: Columns must have the same size\n");
+            return -1;
+        }
+    }
+
+    size_t blocks = (num_columns + FSCL_MATRIX_GRAM_BLOCK - 1) / FSCL_MATRIX_GRAM_BLOCK;
+    size_t num_pairs = blocks * (blocks + 1) / 2;
+    size_t work = rows * num_columns;
+    size_t threads = 1;
+    if (work * num_columns / 2 >= FSCL_MATRIX_SERIAL && fscl_data_parallel(FSCL_DATA_EXEC_DEFAULT)) {
+        threads = fscl_parallel_get_threads();
+    }
+
+    // One run of block pairs per thread, each with its own packing buffers
+    // kept on whole cache lines
+    cmatrix_gram_job job = {columns, NULL, rows, num_columns, NULL, NULL, 0, NULL, 0};
+    job.grain = (num_pairs + threads - 1) / threads;
+    job.packing_size = fscl_matrix_packed_a_size(FSCL_MATRIX_GRAM_BLOCK, rows) +
+                       fscl_matrix_packed_b_size(FSCL_MATRIX_GRAM_BLOCK, rows);
+    job.packing_size = (job.packing_size + 7) / 8 * 8;
+    size_t chunks = (num_pairs + job.grain - 1) / job.grain;
+    job.centered = (double *)malloc(rows * num_columns * sizeof(double));
+    job.pairs = (size_t *)malloc(2 * num_pairs * sizeof(size_t));
+    job.packing = (double *)fscl_matrix_alloc(chunks * job.packing_size * sizeof(double));
+    fscl_data_create(result, num_columns * num_columns);
+    if (job.centered == NULL || job.pairs == NULL || job.packing == NULL || result->data == NULL) {
+        fprintf(stderr, "Error: Memory allocation failed\n");
+        free(job.centered);
+        free(job.pairs);
+        fscl_matrix_free(job.packing);
+        fscl_data_erase(result);
+        return -1;
+    }
+    job.result = result->data;
+
+    size_t p = 0;
+    for (size_t ib = 0; ib < blocks; ++ib) {
+        for (size_t jb = ib; jb < blocks; ++jb) {
+            job.pairs[2 * p] = ib * FSCL_MATRIX_GRAM_BLOCK;
+            job.pairs[2 * p + 1] = jb * FSCL_MATRIX_GRAM_BLOCK;
+            ++p;
+        }
+    }
+
+    fscl_matrix_run(num_columns, 1, work, fscl_matrix_center_columns, &job);
+    fscl_matrix_run(num_pairs, job.grain, work * num_columns / 2, fscl_matrix_gram_blocks, &job);
+
+    // Mirror the upper triangle
+    for (size_t i = 0; i < num_columns; ++i) {
+        for (size_t j = 0; j < i; ++j) {
+            result->data[i * num_columns + j] = result->data[j * num_columns + i];
+        }
+    }
+
+    free(job.centered);
+    free(job.pairs);
+    fscl_matrix_free(job.packing);
+    return 0;
+}
+
+// Function to compute the correlation matrix of a set of columns
+int fscl_data_correlation_matrix(const cdataset *columns, size_t num_columns, cdataset *result) {
+    if (fscl_data_covariance_matrix(columns, num_columns, result) != 0) {
+        return -1;
+    }
+
+    double *scale = (double *)malloc(num_columns * sizeof(double));
+    if (scale == NULL) {
+        fprintf(stderr, "Error: Memory allocation failed\n");
+        fscl_data_erase(result);
+        return -1;
+    }
+    for (size_t i = 0; i < num_columns; ++i) {
+        double variance = result->data[i * num_columns + i];
+        scale[i] = variance > 0.0 ? 1.0 / sqrt(variance) : NAN;
+    }
+    for (size_t i = 0; i < num_columns; ++i) {
+        for (size_t j = 0; j < num_columns; ++j) {
+            double *value = &result->data[i * num_columns + j];
+            double r = *value * scale[i] * scale[j];
+            if (i == j && !isnan(r)) {
+                r = 1.0;
+            }
+            *value = r > 1.0 ? 1.0 : (r < -1.0 ? -1.0 : r);
+        }
+    }
+    free(scale);
+    return 0;
+}
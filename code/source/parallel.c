@@ -0,0 +1,265 @@
+/*
+==============================================================================
+Author: Michael Gene Brockus (Dreamer)
+Email: michaelbrockus@gmail.com
+Organization: Fossil Logic
+Description: 
+    This file is part of the Fossil Logic project, where innovation meets
+    excellence in software development. Michael Gene Brockus, also known as
+    "Dreamer," is a dedicated contributor to this project. For any inquiries,
+    feel free to contact Michael at michaelbrockus@gmail.com.
+==============================================================================
+*/
+#if !defined(_WIN32)
+#define _POSIX_C_SOURCE 200809L
+#if defined(__APPLE__)
+#define _DARWIN_C_SOURCE
+#endif
+#endif
+
+#include "fossil/xscience/parallel.h"
+#include <stdatomic.h>
+#include <stdlib.h>
+
+#if defined(_WIN32)
+#include <windows.h>
+typedef HANDLE fscl_parallel_thread;
+typedef SRWLOCK fscl_parallel_mutex;
+typedef CONDITION_VARIABLE fscl_parallel_cond;
+#define FSCL_PARALLEL_MUTEX_INIT SRWLOCK_INIT
+#define FSCL_PARALLEL_COND_INIT CONDITION_VARIABLE_INIT
+#define fscl_parallel_lock(m) AcquireSRWLockExclusive(m)
+#define fscl_parallel_trylock(m) (TryAcquireSRWLockExclusive(m) != 0)
+#define fscl_parallel_unlock(m) ReleaseSRWLockExclusive(m)
+#define fscl_parallel_wait(c, m) SleepConditionVariableSRW((c), (m), INFINITE, 0)
+#define fscl_parallel_broadcast(c) WakeAllConditionVariable(c)
+#else
+#include <pthread.h>
+#include <unistd.h>
+typedef pthread_t fscl_parallel_thread;
+typedef pthread_mutex_t fscl_parallel_mutex;
+typedef pthread_cond_t fscl_parallel_cond;
+#define FSCL_PARALLEL_MUTEX_INIT PTHREAD_MUTEX_INITIALIZER
+#define FSCL_PARALLEL_COND_INIT PTHREAD_COND_INITIALIZER
+#define fscl_parallel_lock(m) pthread_mutex_lock(m)
+#define fscl_parallel_trylock(m) (pthread_mutex_trylock(m) == 0)
+#define fscl_parallel_unlock(m) pthread_mutex_unlock(m)
+#define fscl_parallel_wait(c, m) pthread_cond_wait((c), (m))
+#define fscl_parallel_broadcast(c) pthread_cond_broadcast(c)
+#endif
+
+// Loop currently handed to the pool
+typedef struct {
+    cparallel_task task;
+    void *context;
+    size_t count;
+    size_t grain;
+} cparallel_job;
+
+// Persistent worker pool; `lock` guards every field below `submit` except
+// `requested`, which is written under `submit` and read without a lock
+static struct {
+    fscl_parallel_mutex submit;   // held by the caller running a loop
+    fscl_parallel_mutex lock;
+    fscl_parallel_cond wake;
+    fscl_parallel_cond done;
+    fscl_parallel_thread *threads;
+    atomic_size_t requested;      // configured thread count
+    size_t started;               // threads in the pool including the caller
+    size_t pending;               // workers still busy with the current job
+    unsigned long generation;     // bumped for every job
+    int stop;
+    cparallel_job job;
+} fscl_pool = {
+    FSCL_PARALLEL_MUTEX_INIT, FSCL_PARALLEL_MUTEX_INIT,
+    FSCL_PARALLEL_COND_INIT, FSCL_PARALLEL_COND_INIT,
+    NULL, 1, 1, 0, 0, 0, {NULL, NULL, 0, 0}
+};
+
+// Function to run the chunks assigned to one participant of a job
+static void fscl_parallel_run_share(const cparallel_job *job, size_t index, size_t participants) {
+    size_t chunks = (job->count + job->grain - 1) / job->grain;
+    size_t first = chunks * index / participants;
+    size_t last = chunks * (index + 1) / participants;
+
+    for (size_t chunk = first; chunk < last; ++chunk) {
+        size_t begin = chunk * job->grain;
+        size_t end = begin + job->grain;
+        if (end > job->count) {
+            end = job->count;
+        }
+        job->task(job->context, begin, end);
+    }
+}
+
+// Function executed by every worker thread
+#if defined(_WIN32)
+static DWORD WINAPI fscl_parallel_worker(LPVOID arg) {
+#else
+static void *fscl_parallel_worker(void *arg) {
+#endif
+    size_t index = (size_t)arg;
+    unsigned long seen = 0;
+
+    fscl_parallel_lock(&fscl_pool.lock);
+    for (;;) {
+        while (!fscl_pool.stop && fscl_pool.generation == seen) {
+            fscl_parallel_wait(&fscl_pool.wake, &fscl_pool.lock);
+        }
+        if (fscl_pool.stop) {
+            break;
+        }
+        seen = fscl_pool.generation;
+        cparallel_job job = fscl_pool.job;
+        size_t participants = fscl_pool.started;
+        fscl_parallel_unlock(&fscl_pool.lock);
+
+        fscl_parallel_run_share(&job, index, participants);
+
+        fscl_parallel_lock(&fscl_pool.lock);
+        if (--fscl_pool.pending == 0) {
+            fscl_parallel_broadcast(&fscl_pool.done);
+        }
+    }
+    fscl_parallel_unlock(&fscl_pool.lock);
+    return 0;
+}
+
+// Function to start the workers; the caller holds the submit lock
+static void fscl_parallel_start(void) {
+    size_t wanted = atomic_load_explicit(&fscl_pool.requested, memory_order_relaxed);
+
+    fscl_pool.threads = (fscl_parallel_thread *)malloc((wanted - 1) * sizeof(fscl_parallel_thread));
+    if (fscl_pool.threads == NULL) {
+        atomic_store_explicit(&fscl_pool.requested, 1, memory_order_relaxed);
+        return;
+    }
+
+    size_t started = 1;
+    fscl_pool.stop = 0;
+    fscl_pool.generation = 0;
+    for (; started < wanted; ++started) {
+        void *arg = (void *)started;
+#if defined(_WIN32)
+        fscl_pool.threads[started - 1] = CreateThread(NULL, 0, fscl_parallel_worker, arg, 0, NULL);
+        if (fscl_pool.threads[started - 1] == NULL) {
+            break;
+        }
+#else
+        if (pthread_create(&fscl_pool.threads[started - 1], NULL, fscl_parallel_worker, arg) != 0) {
+            break;
+        }
+#endif
+    }
+    fscl_pool.started = started;
+}
+
+// Function to stop and join the workers; the caller holds the submit lock
+static void fscl_parallel_stop(void) {
+    if (fscl_pool.threads == NULL) {
+        return;
+    }
+
+    fscl_parallel_lock(&fscl_pool.lock);
+    fscl_pool.stop = 1;
+    fscl_parallel_broadcast(&fscl_pool.wake);
+    fscl_parallel_unlock(&fscl_pool.lock);
+
+    for (size_t i = 0; i + 1 < fscl_pool.started; ++i) {
+#if defined(_WIN32)
+        WaitForSingleObject(fscl_pool.threads[i], INFINITE);
+        CloseHandle(fscl_pool.threads[i]);
+#else
+        pthread_join(fscl_pool.threads[i], NULL);
+#endif
+    }
+
+    free(fscl_pool.threads);
+    fscl_pool.threads = NULL;
+    fscl_pool.started = 1;
+    fscl_pool.stop = 0;
+}
+
+// Function to count the online CPUs
+size_t fscl_parallel_cpu_count(void) {
+#if defined(_WIN32)
+    SYSTEM_INFO info;
+    GetSystemInfo(&info);
+    return info.dwNumberOfProcessors > 0 ? (size_t)info.dwNumberOfProcessors : 1;
+#else
+    long count = sysconf(_SC_NPROCESSORS_ONLN);
+    return count > 0 ? (size_t)count : 1;
+#endif
+}
+
+// Function to set the number of threads used by parallel loops
+void fscl_parallel_set_threads(size_t threads) {
+    if (threads == 0) {
+        threads = fscl_parallel_cpu_count();
+    }
+
+    fscl_parallel_lock(&fscl_pool.submit);
+    if (threads != atomic_load_explicit(&fscl_pool.requested, memory_order_relaxed)) {
+        fscl_parallel_stop();
+        atomic_store_explicit(&fscl_pool.requested, threads, memory_order_relaxed);
+    }
+    fscl_parallel_unlock(&fscl_pool.submit);
+}
+
+// Function to get the number of threads used by parallel loops
+size_t fscl_parallel_get_threads(void) {
+    return atomic_load_explicit(&fscl_pool.requested, memory_order_relaxed);
+}
+
+// Function to run a task over [0, count) in chunks on the pool
+void fscl_parallel_for(size_t count, size_t grain, cparallel_task task, void *context) {
+    if (count == 0) {
+        return;
+    }
+    if (grain == 0) {
+        grain = 1;
+    }
+
+    cparallel_job job = {task, context, count, grain};
+
+    // Single chunk, serial configuration or nested/concurrent call; the
+    // count is read again under `submit`, where set_threads cannot change it
+    if (count <= grain || fscl_parallel_get_threads() <= 1 || !fscl_parallel_trylock(&fscl_pool.submit)) {
+        fscl_parallel_run_share(&job, 0, 1);
+        return;
+    }
+
+    if (fscl_pool.threads == NULL && fscl_parallel_get_threads() > 1) {
+        fscl_parallel_start();
+    }
+    if (fscl_pool.started <= 1) {
+        fscl_parallel_unlock(&fscl_pool.submit);
+        fscl_parallel_run_share(&job, 0, 1);
+        return;
+    }
+
+    size_t participants = fscl_pool.started;
+    fscl_parallel_lock(&fscl_pool.lock);
+    fscl_pool.job = job;
+    fscl_pool.pending = participants - 1;
+    ++fscl_pool.generation;
+    fscl_parallel_broadcast(&fscl_pool.wake);
+    fscl_parallel_unlock(&fscl_pool.lock);
+
+    fscl_parallel_run_share(&job, 0, participants);
+
+    fscl_parallel_lock(&fscl_pool.lock);
+    while (fscl_pool.pending > 0) {
+        fscl_parallel_wait(&fscl_pool.done, &fscl_pool.lock);
+    }
+    fscl_parallel_unlock(&fscl_pool.lock);
+
+    fscl_parallel_unlock(&fscl_pool.submit);
+}
+
+// Function to stop the worker threads
+void fscl_parallel_shutdown(void) {
+    fscl_parallel_lock(&fscl_pool.submit);
+    fscl_parallel_stop();
+    fscl_parallel_unlock(&fscl_pool.submit);
+}
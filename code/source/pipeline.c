@@ -0,0 +1,169 @@
+/*
+==============================================================================
+Author: Michael Gene Brockus (Dreamer)
+Email: michaelbrockus@gmail.com
+Organization: Fossil Logic
+Description: 
+    This file is part of the Fossil Logic project, where innovation meets
+    excellence in software development. Michael Gene Brockus, also known as
+    "Dreamer," is a dedicated contributor to this project. For any inquiries,
+    feel free to contact Michael at michaelbrockus@gmail.com.
+==============================================================================
+*/
+#include "fossil/xscience/pipeline.h"
+#include "fossil/xscience/parallel.h"
+
+// Elements per parallel chunk, matching the dataset engine
+#define FSCL_PIPELINE_CHUNK 16384
+
+// Fused per-element map: isnan(x) ? missing : scale * x + offset
+typedef struct {
+    double *data;
+    double scale;
+    double offset;
+    double missing;
+} cpipeline_map;
+
+// Function to apply the fused map to one chunk
+static void fscl_pipeline_apply_chunk(void *context, size_t begin, size_t end) {
+    const cpipeline_map *map = (const cpipeline_map *)context;
+    double *data = map->data;
+    double scale = map->scale, offset = map->offset, missing = map->missing;
+
+    // Branch-free select keeps the loop vectorizable
+    for (size_t i = begin; i < end; ++i) {
+        double x = data[i];
+        double y = scale * x + offset;
+        data[i] = x == x ? y : missing;
+    }
+}
+
+// Function to push a stage, growing the stage list
+static void fscl_pipeline_push(cpipeline *pipeline, cpipeline_op op, double value) {
+    if (pipeline->count == pipeline->capacity) {
+        size_t capacity = pipeline->capacity > 0 ? pipeline->capacity * 2 : 8;
+        cpipeline_stage *stages = (cpipeline_stage *)realloc(pipeline->stages, capacity * sizeof(cpipeline_stage));
+        if (stages == NULL) {
+            fprintf(stderr, "Error: Unable to grow the pipeline.\n");
+            return;
+        }
+        pipeline->stages = stages;
+        pipeline->capacity = capacity;
+    }
+    pipeline->stages[pipeline->count].op = op;
+    pipeline->stages[pipeline->count].value = value;
+    ++pipeline->count;
+}
+
+// Function to compose an affine stage into the map and the derived statistics
+static void fscl_pipeline_affine(cpipeline_map *map, cdataset_stats *stats, double scale, double offset) {
+    map->scale = scale * map->scale;
+    map->offset = scale * map->offset + offset;
+    map->missing = scale * map->missing + offset;  // NaN stays NaN
+
+    stats->sum = scale * stats->sum + offset * (double)stats->count;
+    stats->mean = scale * stats->mean + offset;
+    stats->variance = scale * scale * stats->variance;
+    double low = scale * stats->min + offset;
+    double high = scale * stats->max + offset;
+    stats->min = scale < 0.0 ? high : low;
+    stats->max = scale < 0.0 ? low : high;
+}
+
+// Function to create an empty pipeline
+void fscl_pipeline_create(cpipeline *pipeline) {
+    pipeline->stages = NULL;
+    pipeline->count = 0;
+    pipeline->capacity = 0;
+}
+
+// Function to erase a pipeline
+void fscl_pipeline_erase(cpipeline *pipeline) {
+    free(pipeline->stages);
+    fscl_pipeline_create(pipeline);
+}
+
+void fscl_pipeline_replace_missing(cpipeline *pipeline, double replacement_value) {
+    fscl_pipeline_push(pipeline, FSCL_PIPELINE_REPLACE_MISSING, replacement_value);
+}
+
+void fscl_pipeline_scale(cpipeline *pipeline, double factor) {
+    fscl_pipeline_push(pipeline, FSCL_PIPELINE_SCALE, factor);
+}
+
+void fscl_pipeline_offset(cpipeline *pipeline, double offset) {
+    fscl_pipeline_push(pipeline, FSCL_PIPELINE_OFFSET, offset);
+}
+
+void fscl_pipeline_standardize(cpipeline *pipeline) {
+    fscl_pipeline_push(pipeline, FSCL_PIPELINE_STANDARDIZE, 0.0);
+}
+
+void fscl_pipeline_normalize(cpipeline *pipeline) {
+    fscl_pipeline_push(pipeline, FSCL_PIPELINE_NORMALIZE, 0.0);
+}
+
+// Function to evaluate the pipeline with one fused sweep
+size_t fscl_pipeline_run(const cpipeline *pipeline, cdataset *dataset) {
+    cpipeline_map map = {dataset->data, 1.0, 0.0, NAN};
+    cdataset_stats stats = {0};
+    size_t sweeps = 0;
+
+    // Reductions are hoisted: one statistics pass serves every stage
+    for (size_t i = 0; i < pipeline->count; ++i) {
+        if (pipeline->stages[i].op == FSCL_PIPELINE_STANDARDIZE || pipeline->stages[i].op == FSCL_PIPELINE_NORMALIZE) {
+            fscl_data_stats(dataset, &stats);
+            ++sweeps;
+            break;
+        }
+    }
+
+    for (size_t i = 0; i < pipeline->count; ++i) {
+        double value = pipeline->stages[i].value;
+        switch (pipeline->stages[i].op) {
+            case FSCL_PIPELINE_REPLACE_MISSING:
+                if (isnan(map.missing)) {
+                    // Fold the replaced elements into the statistics
+                    cdataset_stats filled = {0};
+                    filled.count = stats.nan_count;
+                    filled.sum = value * (double)stats.nan_count;
+                    filled.mean = value;
+                    filled.min = value;
+                    filled.max = value;
+                    stats.nan_count = 0;
+                    fscl_data_stats_merge(&stats, &filled);
+                    map.missing = value;
+                }
+                break;
+            case FSCL_PIPELINE_SCALE:
+                fscl_pipeline_affine(&map, &stats, value, 0.0);
+                break;
+            case FSCL_PIPELINE_OFFSET:
+                fscl_pipeline_affine(&map, &stats, 1.0, value);
+                break;
+            case FSCL_PIPELINE_STANDARDIZE: {
+                double std_dev = sqrt(stats.variance);
+                if (std_dev != 0.0 && !isnan(std_dev)) {
+                    fscl_pipeline_affine(&map, &stats, 1.0 / std_dev, -stats.mean / std_dev);
+                }
+                break;
+            }
+            case FSCL_PIPELINE_NORMALIZE: {
+                double range = stats.max - stats.min;
+                if (range != 0.0 && !isnan(range)) {
+                    fscl_pipeline_affine(&map, &stats, 1.0 / range, -stats.min / range);
+                }
+                break;
+            }
+        }
+    }
+
+    if (map.scale == 1.0 && map.offset == 0.0 && isnan(map.missing)) {
+        return sweeps;  // identity
+    }
+
+    fscl_data_index_drop(dataset);
+    fscl_data_for(FSCL_DATA_EXEC_DEFAULT, dataset->size, FSCL_PIPELINE_CHUNK, fscl_pipeline_apply_chunk, &map);
+    fscl_data_zones_update(dataset, 0, dataset->size);
+    return sweeps + 1;
+}
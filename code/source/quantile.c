@@ -0,0 +1,468 @@
+/*
+==============================================================================
+Author: Michael Gene Brockus (Dreamer)
+Email: michaelbrockus@gmail.com
+Organization: Fossil Logic
+Description: 
+    This file is part of the Fossil Logic project, where innovation meets
+    excellence in software development. Michael Gene Brockus, also known as
+    "Dreamer," is a dedicated contributor to this project. For any inquiries,
+    feel free to contact Michael at michaelbrockus@gmail.com.
+==============================================================================
+*/
+#include "fossil/xscience/quantile.h"
+#include "fossil/xscience/parallel.h"
+#include "fossil/xscience/sort.h"
+#include <string.h>
+
+// Accuracy and chunk size of the sketches used above
+// FSCL_QUANTILE_EXACT_LIMIT
+#define FSCL_QUANTILE_SKETCH_K 256
+#define FSCL_QUANTILE_CHUNK ((size_t)1 << 20)
+
+// Weighted sample used to answer sketch queries
+typedef struct {
+    double value;
+    uint64_t weight;
+} cquantile_item;
+
+static int fscl_quantile_compare(const void *a, const void *b) {
+    double x = *(const double *)a, y = *(const double *)b;
+    return (x > y) - (x < y);
+}
+
+static int fscl_quantile_compare_item(const void *a, const void *b) {
+    return fscl_quantile_compare(&((const cquantile_item *)a)->value, &((const cquantile_item *)b)->value);
+}
+
+// Function to set the number of levels and the capacity of each. Level 0
+// is the input buffer and always holds k items; above it, capacity shrinks
+// by 2/3 per level down from the top, which holds k.
+static void fscl_sketch_set_levels(cquantile_sketch *sketch, size_t levels) {
+    double capacity = (double)sketch->k;
+
+    sketch->levels = levels;
+    sketch->capacity = 0;
+    for (size_t h = levels; h-- > 0;) {
+        sketch->capacities[h] = h == 0 ? sketch->k : capacity > 2.0 ? (size_t)capacity : 2;
+        sketch->capacity += sketch->capacities[h];
+        capacity *= 2.0 / 3.0;
+    }
+}
+
+// Function to append an item to the unsorted input level
+static void fscl_sketch_push(cquantile_sketch *sketch, double value) {
+    if (sketch->sizes[0] == sketch->allocated[0]) {
+        size_t allocated = sketch->allocated[0] > 0 ? sketch->allocated[0] * 2 : sketch->k;
+        double *items = (double *)realloc(sketch->items[0], allocated * sizeof(double));
+        if (items == NULL) {
+            return;  // dropping one sample only widens the error
+        }
+        sketch->items[0] = items;
+        sketch->allocated[0] = allocated;
+    }
+    sketch->items[0][sketch->sizes[0]++] = value;
+}
+
+// Function to sort a level in place: quicksort with Hoare partitioning
+// (so runs of equal values split evenly) and insertion sort for short
+// ranges; compares are inlined, which is most of the cost of a compaction
+static void fscl_sketch_sort(double *items, size_t size) {
+    while (size > 16) {
+        double a = items[0], b = items[size / 2], c = items[size - 1];
+        double pivot = a < b ? (b < c ? b : (a < c ? c : a)) : (a < c ? a : (b < c ? c : b));
+
+        size_t i = 0, j = size - 1;
+        for (;;) {
+            while (items[i] < pivot) ++i;
+            while (items[j] > pivot) --j;
+            if (i >= j) {
+                break;
+            }
+            double t = items[i]; items[i] = items[j]; items[j] = t;
+            ++i;
+            --j;
+        }
+
+        // Recurse into the smaller side, loop on the larger one
+        size_t left = j + 1;
+        if (left < size - left) {
+            fscl_sketch_sort(items, left);
+            items += left;
+            size -= left;
+        } else {
+            fscl_sketch_sort(items + left, size - left);
+            size = left;
+        }
+    }
+
+    for (size_t i = 1; i < size; ++i) {
+        double value = items[i];
+        size_t j = i;
+        while (j > 0 && items[j - 1] > value) {
+            items[j] = items[j - 1];
+            --j;
+        }
+        items[j] = value;
+    }
+}
+
+// Function to merge `count` sorted values, read `stride` apart, into a
+// sorted level (levels above 0 are kept sorted, so compacting them needs
+// no sort)
+static void fscl_sketch_insert(cquantile_sketch *sketch, size_t level, const double *values, size_t count, size_t stride) {
+    size_t size = sketch->sizes[level];
+    if (size + count > sketch->allocated[level]) {
+        size_t allocated = sketch->allocated[level] * 2;
+        if (allocated < size + count) allocated = size + count;
+        if (allocated < sketch->k) allocated = sketch->k;
+        double *items = (double *)realloc(sketch->items[level], allocated * sizeof(double));
+        if (items == NULL) {
+            return;  // dropping samples only widens the error
+        }
+        sketch->items[level] = items;
+        sketch->allocated[level] = allocated;
+    }
+
+    // Merge from the back so no scratch buffer is needed
+    double *items = sketch->items[level];
+    size_t i = size, j = count, out = size + count;
+    while (j > 0) {
+        if (i > 0 && items[i - 1] > values[(j - 1) * stride]) {
+            items[--out] = items[--i];
+        } else {
+            items[--out] = values[--j * stride];
+        }
+    }
+    sketch->sizes[level] = size + count;
+}
+
+// Function to halve a level: sort it and promote every other item
+static void fscl_sketch_compact(cquantile_sketch *sketch, size_t level) {
+    if (level + 1 == sketch->levels) {
+        if (sketch->levels == FSCL_SKETCH_MAX_LEVELS) {
+            return;
+        }
+        fscl_sketch_set_levels(sketch, sketch->levels + 1);
+    }
+
+    double *items = sketch->items[level];
+    size_t size = sketch->sizes[level];
+    if (level == 0) {
+        fscl_sketch_sort(items, size);
+    }
+
+    // xorshift64 coin decides whether odd or even positions survive
+    sketch->random ^= sketch->random << 13;
+    sketch->random ^= sketch->random >> 7;
+    sketch->random ^= sketch->random << 17;
+    size_t pairs = size & ~(size_t)1;
+    fscl_sketch_insert(sketch, level + 1, items + (sketch->random & 1), pairs / 2, 2);
+
+    if (size & 1) {
+        items[0] = items[size - 1];
+        sketch->sizes[level] = 1;
+    } else {
+        sketch->sizes[level] = 0;
+    }
+}
+
+// Function to compact levels until the sketch fits its memory budget
+static void fscl_sketch_compress(cquantile_sketch *sketch) {
+    for (;;) {
+        size_t total = 0;
+        for (size_t h = 0; h < sketch->levels; ++h) {
+            total += sketch->sizes[h];
+        }
+        if (total <= sketch->capacity) {
+            return;
+        }
+
+        size_t h = 0;
+        while (h < sketch->levels && sketch->sizes[h] < sketch->capacities[h]) {
+            ++h;
+        }
+        if (h == sketch->levels || sketch->levels == FSCL_SKETCH_MAX_LEVELS) {
+            return;
+        }
+        fscl_sketch_compact(sketch, h);
+    }
+}
+
+// Function to create an empty sketch
+void fscl_sketch_create(cquantile_sketch *sketch, size_t k) {
+    memset(sketch, 0, sizeof(*sketch));
+    sketch->k = k < 8 ? 8 : k;
+    fscl_sketch_set_levels(sketch, 1);
+    sketch->random = 0x9E3779B97F4A7C15ull;
+    sketch->min = INFINITY;
+    sketch->max = -INFINITY;
+}
+
+// Function to erase a sketch
+void fscl_sketch_erase(cquantile_sketch *sketch) {
+    for (size_t h = 0; h < FSCL_SKETCH_MAX_LEVELS; ++h) {
+        free(sketch->items[h]);
+    }
+    fscl_sketch_create(sketch, sketch->k);
+}
+
+// Function to add a value to the sketch
+void fscl_sketch_update(cquantile_sketch *sketch, double value) {
+    if (isnan(value)) {
+        return;
+    }
+
+    ++sketch->count;
+    if (value < sketch->min) sketch->min = value;
+    if (value > sketch->max) sketch->max = value;
+
+    // Level 0 is a buffer of k values, compacted only when it is full;
+    // the levels above are rebalanced at the same time
+    fscl_sketch_push(sketch, value);
+    if (sketch->sizes[0] >= sketch->k) {
+        fscl_sketch_compact(sketch, 0);
+        fscl_sketch_compress(sketch);
+    }
+}
+
+// Function to add every value of a dataset
+void fscl_sketch_update_data(cquantile_sketch *sketch, const cdataset *dataset) {
+    for (size_t i = 0; i < dataset->size; ++i) {
+        fscl_sketch_update(sketch, dataset->data[i]);
+    }
+}
+
+// Function to merge two sketches
+void fscl_sketch_merge(cquantile_sketch *sketch, const cquantile_sketch *other) {
+    if (other->count == 0) {
+        return;
+    }
+
+    if (sketch->levels < other->levels) {
+        fscl_sketch_set_levels(sketch, other->levels);
+    }
+    for (size_t i = 0; i < other->sizes[0]; ++i) {
+        fscl_sketch_push(sketch, other->items[0][i]);
+    }
+    for (size_t h = 1; h < other->levels; ++h) {
+        fscl_sketch_insert(sketch, h, other->items[h], other->sizes[h], 1);
+    }
+
+    sketch->count += other->count;
+    if (other->min < sketch->min) sketch->min = other->min;
+    if (other->max > sketch->max) sketch->max = other->max;
+    fscl_sketch_compress(sketch);
+}
+
+// Function to estimate a quantile from the sketch
+double fscl_sketch_quantile(const cquantile_sketch *sketch, double q) {
+    if (sketch->count == 0 || isnan(q)) {
+        return NAN;
+    }
+    if (q <= 0.0) {
+        return sketch->min;
+    }
+    if (q >= 1.0) {
+        return sketch->max;
+    }
+
+    size_t total = 0;
+    for (size_t h = 0; h < sketch->levels; ++h) {
+        total += sketch->sizes[h];
+    }
+    cquantile_item *items = (cquantile_item *)malloc(total * sizeof(cquantile_item));
+    if (items == NULL) {
+        return NAN;
+    }
+
+    size_t n = 0;
+    uint64_t weight_total = 0;
+    for (size_t h = 0; h < sketch->levels; ++h) {
+        for (size_t i = 0; i < sketch->sizes[h]; ++i) {
+            items[n].value = sketch->items[h][i];
+            items[n].weight = (uint64_t)1 << h;
+            weight_total += items[n].weight;
+            ++n;
+        }
+    }
+    qsort(items, n, sizeof(cquantile_item), fscl_quantile_compare_item);
+
+    double target = q * (double)weight_total;
+    double result = items[n - 1].value;
+    uint64_t cumulative = 0;
+    for (size_t i = 0; i < n; ++i) {
+        cumulative += items[i].weight;
+        if ((double)cumulative >= target) {
+            result = items[i].value;
+            break;
+        }
+    }
+
+    free(items);
+    return result;
+}
+
+// Function to partition [low, high] around a median-of-three pivot;
+// returns the final position of the pivot
+static size_t fscl_quantile_partition(double *values, size_t low, size_t high) {
+    size_t middle = low + (high - low) / 2;
+    if (values[middle] < values[low]) { double t = values[middle]; values[middle] = values[low]; values[low] = t; }
+    if (values[high] < values[low]) { double t = values[high]; values[high] = values[low]; values[low] = t; }
+    if (values[high] < values[middle]) { double t = values[high]; values[high] = values[middle]; values[middle] = t; }
+
+    double pivot = values[middle];
+    values[middle] = values[high];
+    values[high] = pivot;
+
+    size_t store = low;
+    for (size_t i = low; i < high; ++i) {
+        if (values[i] < pivot) {
+            double t = values[i]; values[i] = values[store]; values[store] = t;
+            ++store;
+        }
+    }
+    values[high] = values[store];
+    values[store] = pivot;
+    return store;
+}
+
+// Function to place the k-th smallest value at values[k] (introselect:
+// quickselect that falls back to sorting when recursion gets too deep)
+static void fscl_quantile_select(double *values, size_t size, size_t k) {
+    size_t low = 0, high = size - 1;
+    size_t depth = 0;
+    for (size_t n = size; n > 1; n >>= 1) {
+        depth += 2;
+    }
+
+    while (low < high) {
+        if (depth-- == 0) {
+            qsort(values + low, high - low + 1, sizeof(double), fscl_quantile_compare);
+            return;
+        }
+        size_t pivot = fscl_quantile_partition(values, low, high);
+        if (pivot == k) {
+            return;
+        }
+        if (k < pivot) {
+            high = pivot - 1;
+        } else {
+            low = pivot + 1;
+        }
+    }
+}
+
+// Shared state of the parallel sketch build
+typedef struct {
+    const double *data;
+    cquantile_sketch *sketches;
+} cquantile_build;
+
+static void fscl_quantile_sketch_chunk(void *context, size_t begin, size_t end) {
+    cquantile_build *build = (cquantile_build *)context;
+    cquantile_sketch *sketch = &build->sketches[begin / FSCL_QUANTILE_CHUNK];
+    cdataset view = {(double *)build->data + begin, end - begin, NULL};
+    fscl_sketch_create(sketch, FSCL_QUANTILE_SKETCH_K);
+    sketch->random ^= (uint64_t)(begin / FSCL_QUANTILE_CHUNK + 1) * 0xBF58476D1CE4E5B9ull;
+    fscl_sketch_update_data(sketch, &view);
+}
+
+// Function to estimate q-quantiles from per-chunk sketches merged in
+// chunk order, so the estimates do not depend on the thread count
+static int fscl_quantile_sketched(const cdataset *dataset, const double *q, size_t count, double *results) {
+    size_t chunks = (dataset->size + FSCL_QUANTILE_CHUNK - 1) / FSCL_QUANTILE_CHUNK;
+    cquantile_build build = {dataset->data, NULL};
+    build.sketches = (cquantile_sketch *)malloc((chunks > 0 ? chunks : 1) * sizeof(cquantile_sketch));
+    if (build.sketches == NULL) {
+        fprintf(stderr, "Error: Memory allocation failed\n");
+        return -1;
+    }
+    if (chunks == 0) {
+        for (size_t p = 0; p < count; ++p) {
+            results[p] = NAN;
+        }
+        free(build.sketches);
+        return 0;
+    }
+
+    fscl_data_for(FSCL_DATA_EXEC_DEFAULT, dataset->size, FSCL_QUANTILE_CHUNK, fscl_quantile_sketch_chunk, &build);
+    for (size_t c = 1; c < chunks; ++c) {
+        fscl_sketch_merge(&build.sketches[0], &build.sketches[c]);
+        fscl_sketch_erase(&build.sketches[c]);
+    }
+
+    for (size_t p = 0; p < count; ++p) {
+        results[p] = fscl_sketch_quantile(&build.sketches[0], q[p]);
+    }
+    fscl_sketch_erase(&build.sketches[0]);
+    free(build.sketches);
+    return 0;
+}
+
+// Function to compute q-quantiles of a dataset
+int fscl_data_quantiles(const cdataset *dataset, const double *q, size_t count, double *results) {
+    // Large inputs are not copied: the per-chunk sketches keep memory
+    // bounded by O(k log n) per chunk
+    if (dataset->size > FSCL_QUANTILE_EXACT_LIMIT) {
+        return fscl_quantile_sketched(dataset, q, count, results);
+    }
+    double *values = (double *)malloc((dataset->size > 0 ? dataset->size : 1) * sizeof(double));
+    if (values == NULL) {
+        return fscl_quantile_sketched(dataset, q, count, results);
+    }
+    size_t n = 0;
+    for (size_t i = 0; i < dataset->size; ++i) {
+        if (!isnan(dataset->data[i])) {
+            values[n++] = dataset->data[i];
+        }
+    }
+
+    // Several quantiles share one sort; if the sort has no memory each
+    // quantile falls back to its own selection
+    cdataset view = {values, n, NULL};
+    int sorted = count > 1 && n > 1 && fscl_data_sort(&view, FSCL_SORT_NAN_LAST) == 0;
+
+    for (size_t p = 0; p < count; ++p) {
+        double quantile = q[p];
+        if (n == 0 || isnan(quantile)) {
+            results[p] = NAN;
+            continue;
+        }
+        if (quantile < 0.0) quantile = 0.0;
+        if (quantile > 1.0) quantile = 1.0;
+
+        double position = quantile * (double)(n - 1);
+        size_t k = (size_t)position;
+        double fraction = position - (double)k;
+        if (!sorted) {
+            fscl_quantile_select(values, n, k);
+        }
+        double result = values[k];
+        if (fraction > 0.0 && k + 1 < n) {
+            // The next order statistic is the smallest value right of k
+            double next = values[k + 1];
+            for (size_t i = k + 2; !sorted && i < n; ++i) {
+                if (values[i] < next) next = values[i];
+            }
+            result += fraction * (next - result);
+        }
+        results[p] = result;
+    }
+    free(values);
+    return 0;
+}
+
+// Function to compute the q-quantile of a dataset
+double fscl_data_quantile(const cdataset *dataset, double q) {
+    double result;
+    if (fscl_data_quantiles(dataset, &q, 1, &result) != 0) {
+        return NAN;
+    }
+    return result;
+}
+
+// Function to compute the median of a dataset
+double fscl_data_median(const cdataset *dataset) {
+    return fscl_data_quantile(dataset, 0.5);
+}
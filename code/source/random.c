@@ -0,0 +1,297 @@
+/*
+==============================================================================
+Author: Michael Gene Brockus (Dreamer)
+Email: michaelbrockus@gmail.com
+Organization: Fossil Logic
+Description: 
+    This file is part of the Fossil Logic project, where innovation meets
+    excellence in software development. Michael Gene Brockus, also known as
+    "Dreamer," is a dedicated contributor to this project. For any inquiries,
+    feel free to contact Michael at michaelbrockus@gmail.com.
+==============================================================================
+*/
+#include "fossil/xscience/random.h"
+#include "fossil/xscience/parallel.h"
+#include <string.h>
+
+#if defined(__x86_64__) || defined(_M_X64) || defined(__i386__) || defined(_M_IX86)
+#define FSCL_RANDOM_X86
+#include <immintrin.h>
+#if defined(_MSC_VER) && !defined(__clang__)
+#define FSCL_RANDOM_TARGET(isa)
+#else
+#define FSCL_RANDOM_TARGET(isa) __attribute__((target(isa)))
+#endif
+#endif
+
+// Values per stream in fscl_data_fill_random_ex (512 KiB)
+#define FSCL_RANDOM_CHUNK ((size_t)1 << 16)
+
+// Raw draws generated at a time by the bulk fill, kept in L1
+#define FSCL_RANDOM_BATCH 256
+
+#define FSCL_RANDOM_LANES 4
+
+static const double fscl_random_two_pi = 6.283185307179586476925286766559;
+
+// Next seed of fscl_data_fill_random
+static uint64_t fscl_random_default_seed = 0x853C49E6748FEA9Bull;
+
+// Four streams stored by state word, so lane k is s[0..3][k]
+typedef struct {
+    uint64_t s[4][FSCL_RANDOM_LANES];
+} crandom_lanes;
+
+static uint64_t fscl_random_rotl(uint64_t x, int k) {
+    return (x << k) | (x >> (64 - k));
+}
+
+static uint64_t fscl_random_splitmix(uint64_t *state) {
+    uint64_t z = (*state += 0x9E3779B97F4A7C15ull);
+    z = (z ^ (z >> 30)) * 0xBF58476D1CE4E5B9ull;
+    z = (z ^ (z >> 27)) * 0x94D049BB133111EBull;
+    return z ^ (z >> 31);
+}
+
+// Function to map 64 random bits to [0, 1) through the mantissa, which
+// the vector path can do without a 64-bit integer conversion
+static double fscl_random_unit(uint64_t bits) {
+    uint64_t mantissa = (bits >> 12) | 0x3FF0000000000000ull;
+    double value;
+    memcpy(&value, &mantissa, sizeof(value));
+    return value - 1.0;
+}
+
+// Function to advance a stream by the polynomial in `table`
+static void fscl_random_jump_by(crandom *rng, const uint64_t table[4]) {
+    uint64_t s[4] = {0, 0, 0, 0};
+    for (int i = 0; i < 4; ++i) {
+        for (int b = 0; b < 64; ++b) {
+            if (table[i] & ((uint64_t)1 << b)) {
+                s[0] ^= rng->s[0];
+                s[1] ^= rng->s[1];
+                s[2] ^= rng->s[2];
+                s[3] ^= rng->s[3];
+            }
+            fscl_random_next(rng);
+        }
+    }
+    memcpy(rng->s, s, sizeof(s));
+}
+
+// Function to seed a stream
+void fscl_random_seed(crandom *rng, uint64_t seed) {
+    for (int i = 0; i < 4; ++i) {
+        rng->s[i] = fscl_random_splitmix(&seed);
+    }
+}
+
+// Function to advance a stream by 2^128 draws
+void fscl_random_jump(crandom *rng) {
+    static const uint64_t table[4] = {
+        0x180EC6D33CFD0ABAull, 0xD5A61266F0C9392Cull, 0xA9582618E03FC9AAull, 0x39ABDC4529B1661Cull};
+    fscl_random_jump_by(rng, table);
+}
+
+// Function to advance a stream by 2^192 draws
+void fscl_random_long_jump(crandom *rng) {
+    static const uint64_t table[4] = {
+        0x76E15D3EFEFDCBBFull, 0xC5004E441C522FB3ull, 0x77710069854EE241ull, 0x39109BB02ACBE635ull};
+    fscl_random_jump_by(rng, table);
+}
+
+// Function to draw 64 random bits
+uint64_t fscl_random_next(crandom *rng) {
+    uint64_t *s = rng->s;
+    uint64_t result = fscl_random_rotl(s[1] * 5, 7) * 9;
+    uint64_t t = s[1] << 17;
+
+    s[2] ^= s[0];
+    s[3] ^= s[1];
+    s[1] ^= s[2];
+    s[0] ^= s[3];
+    s[2] ^= t;
+    s[3] = fscl_random_rotl(s[3], 45);
+    return result;
+}
+
+// Function to draw a uniform value in [0, 1)
+double fscl_random_uniform(crandom *rng) {
+    return fscl_random_unit(fscl_random_next(rng));
+}
+
+// Function to draw a normal value
+double fscl_random_normal(crandom *rng, double mean, double std_dev) {
+    double u1 = 1.0 - fscl_random_uniform(rng);  // (0, 1], so the log is finite
+    double u2 = fscl_random_uniform(rng);
+    return mean + std_dev * sqrt(-2.0 * log(u1)) * cos(fscl_random_two_pi * u2);
+}
+
+// Function to draw an exponential value
+double fscl_random_exponential(crandom *rng, double rate) {
+    return -log(1.0 - fscl_random_uniform(rng)) / rate;
+}
+
+// Function to draw `count` values (a multiple of the lane count), lane by
+// lane in turn
+static void fscl_random_lanes_scalar(crandom_lanes *lanes, uint64_t *out, size_t count) {
+    for (size_t i = 0; i < count; i += FSCL_RANDOM_LANES) {
+        for (size_t k = 0; k < FSCL_RANDOM_LANES; ++k) {
+            crandom rng = {{lanes->s[0][k], lanes->s[1][k], lanes->s[2][k], lanes->s[3][k]}};
+            out[i + k] = fscl_random_next(&rng);
+            lanes->s[0][k] = rng.s[0];
+            lanes->s[1][k] = rng.s[1];
+            lanes->s[2][k] = rng.s[2];
+            lanes->s[3][k] = rng.s[3];
+        }
+    }
+}
+
+#ifdef FSCL_RANDOM_X86
+FSCL_RANDOM_TARGET("avx2")
+static __m256i fscl_random_rotl_avx2(__m256i x, int k) {
+    return _mm256_or_si256(_mm256_slli_epi64(x, k), _mm256_srli_epi64(x, 64 - k));
+}
+
+FSCL_RANDOM_TARGET("avx2")
+static void fscl_random_lanes_avx2(crandom_lanes *lanes, uint64_t *out, size_t count) {
+    __m256i s0 = _mm256_loadu_si256((const __m256i *)lanes->s[0]);
+    __m256i s1 = _mm256_loadu_si256((const __m256i *)lanes->s[1]);
+    __m256i s2 = _mm256_loadu_si256((const __m256i *)lanes->s[2]);
+    __m256i s3 = _mm256_loadu_si256((const __m256i *)lanes->s[3]);
+
+    for (size_t i = 0; i < count; i += FSCL_RANDOM_LANES) {
+        // x * 5 and x * 9 as shift-and-add; AVX2 has no 64-bit multiply
+        __m256i x = _mm256_add_epi64(_mm256_slli_epi64(s1, 2), s1);
+        x = fscl_random_rotl_avx2(x, 7);
+        x = _mm256_add_epi64(_mm256_slli_epi64(x, 3), x);
+        _mm256_storeu_si256((__m256i *)(out + i), x);
+
+        __m256i t = _mm256_slli_epi64(s1, 17);
+        s2 = _mm256_xor_si256(s2, s0);
+        s3 = _mm256_xor_si256(s3, s1);
+        s1 = _mm256_xor_si256(s1, s2);
+        s0 = _mm256_xor_si256(s0, s3);
+        s2 = _mm256_xor_si256(s2, t);
+        s3 = fscl_random_rotl_avx2(s3, 45);
+    }
+
+    _mm256_storeu_si256((__m256i *)lanes->s[0], s0);
+    _mm256_storeu_si256((__m256i *)lanes->s[1], s1);
+    _mm256_storeu_si256((__m256i *)lanes->s[2], s2);
+    _mm256_storeu_si256((__m256i *)lanes->s[3], s3);
+}
+#endif
+
+// Function to fill values from a distribution
+void fscl_random_fill(crandom *rng, double *values, size_t count, crandom_dist dist, double a, double b) {
+    void (*generate)(crandom_lanes *, uint64_t *, size_t) = fscl_random_lanes_scalar;
+#ifdef FSCL_RANDOM_X86
+    if (fscl_data_simd_level() >= FSCL_DATA_SIMD_AVX2) {
+        generate = fscl_random_lanes_avx2;
+    }
+#endif
+
+    crandom_lanes lanes;
+    crandom stream = *rng;
+    for (size_t k = 0; k < FSCL_RANDOM_LANES; ++k) {
+        for (int w = 0; w < 4; ++w) {
+            lanes.s[w][k] = stream.s[w];
+        }
+        fscl_random_jump(&stream);
+    }
+
+    uint64_t bits[FSCL_RANDOM_BATCH];
+    double span = b - a;
+    for (size_t begin = 0; begin < count; begin += FSCL_RANDOM_BATCH) {
+        size_t size = count - begin > FSCL_RANDOM_BATCH ? FSCL_RANDOM_BATCH : count - begin;
+        size_t draws = (size + FSCL_RANDOM_LANES - 1) & ~(size_t)(FSCL_RANDOM_LANES - 1);
+        generate(&lanes, bits, draws);
+
+        double *out = values + begin;
+        switch (dist) {
+            case FSCL_RANDOM_UNIFORM:
+                for (size_t i = 0; i < size; ++i) {
+                    out[i] = a + span * fscl_random_unit(bits[i]);
+                }
+                break;
+            case FSCL_RANDOM_NORMAL:
+                // Each pair of draws gives two values
+                for (size_t i = 0; i < size; i += 2) {
+                    double radius = b * sqrt(-2.0 * log(1.0 - fscl_random_unit(bits[i])));
+                    double angle = fscl_random_two_pi * fscl_random_unit(bits[i + 1]);
+                    out[i] = a + radius * cos(angle);
+                    if (i + 1 < size) {
+                        out[i + 1] = a + radius * sin(angle);
+                    }
+                }
+                break;
+            case FSCL_RANDOM_EXPONENTIAL:
+                for (size_t i = 0; i < size; ++i) {
+                    out[i] = -log(1.0 - fscl_random_unit(bits[i])) / a;
+                }
+                break;
+        }
+    }
+
+    for (int w = 0; w < 4; ++w) {
+        rng->s[w] = lanes.s[w][0];
+    }
+}
+
+// Shared state of a parallel fill
+typedef struct {
+    double *data;
+    const crandom *streams;   // one per chunk
+    crandom_dist dist;
+    double a;
+    double b;
+} crandom_job;
+
+static void fscl_random_fill_chunk(void *context, size_t begin, size_t end) {
+    crandom_job *job = (crandom_job *)context;
+    crandom rng = job->streams[begin / FSCL_RANDOM_CHUNK];
+    fscl_random_fill(&rng, job->data + begin, end - begin, job->dist, job->a, job->b);
+}
+
+// Function to fill a dataset from a distribution
+void fscl_data_fill_random_ex(cdataset *dataset, uint64_t seed, crandom_dist dist, double a, double b) {
+    fscl_data_index_drop(dataset);
+
+    size_t chunks = (dataset->size + FSCL_RANDOM_CHUNK - 1) / FSCL_RANDOM_CHUNK;
+    crandom *streams = (crandom *)malloc((chunks > 0 ? chunks : 1) * sizeof(crandom));
+    crandom rng;
+    fscl_random_seed(&rng, seed);
+
+    if (streams == NULL) {
+        // Same values, one chunk after another on this thread
+        for (size_t begin = 0; begin < dataset->size; begin += FSCL_RANDOM_CHUNK) {
+            size_t size = dataset->size - begin > FSCL_RANDOM_CHUNK ? FSCL_RANDOM_CHUNK : dataset->size - begin;
+            crandom chunk = rng;
+            fscl_random_fill(&chunk, dataset->data + begin, size, dist, a, b);
+            fscl_random_long_jump(&rng);
+        }
+    } else {
+        for (size_t c = 0; c < chunks; ++c) {
+            streams[c] = rng;
+            fscl_random_long_jump(&rng);
+        }
+        crandom_job job = {dataset->data, streams, dist, a, b};
+        fscl_data_for(FSCL_DATA_EXEC_DEFAULT, dataset->size, FSCL_RANDOM_CHUNK, fscl_random_fill_chunk, &job);
+        free(streams);
+    }
+
+    fscl_data_zones_update(dataset, 0, dataset->size);
+}
+
+// Function to set the seed of the next fscl_data_fill_random call
+void fscl_data_seed_random(uint64_t seed) {
+    fscl_random_default_seed = seed;
+}
+
+// Function to fill the dataset with random values in [0, 100)
+void fscl_data_fill_random(cdataset *dataset) {
+    uint64_t seed = fscl_random_default_seed;
+    fscl_random_default_seed += 0x9E3779B97F4A7C15ull;
+    fscl_data_fill_random_ex(dataset, seed, FSCL_RANDOM_UNIFORM, 0.0, 100.0);
+}
@@ -0,0 +1,217 @@
+/*
+==============================================================================
+Author: Michael Gene Brockus (Dreamer)
+Email: michaelbrockus@gmail.com
+Organization: Fossil Logic
+Description: 
+    This file is part of the Fossil Logic project, where innovation meets
+    excellence in software development. Michael Gene Brockus, also known as
+    "Dreamer," is a dedicated contributor to this project. For any inquiries,
+    feel free to contact Michael at michaelbrockus@gmail.com.
+==============================================================================
+*/
+#include "fossil/xscience/rolling.h"
+#include "fossil/xscience/parallel.h"
+#include <string.h>
+
+// Output elements per chunk of fscl_data_rolling; windows longer than a
+// quarter chunk run as a single chunk so warm-up stays a small fraction
+#define FSCL_ROLLING_CHUNK ((size_t)1 << 16)
+
+// Function to fetch the sample with the given number from the ring
+static double fscl_rolling_value(const crolling *rolling, uint64_t sample) {
+    return rolling->values[sample % rolling->window];
+}
+
+// Function to recompute the running sums from the window (two passes)
+static void fscl_rolling_recompute(crolling *rolling) {
+    size_t size = rolling->pushed < rolling->window ? (size_t)rolling->pushed : rolling->window;
+    size_t count = 0;
+    double sum = 0.0;
+    for (size_t i = 0; i < size; ++i) {
+        double value = rolling->values[i];
+        if (!isnan(value)) {
+            ++count;
+            sum += value;
+        }
+    }
+
+    double mean = count > 0 ? sum / (double)count : 0.0;
+    double m2 = 0.0;
+    for (size_t i = 0; i < size; ++i) {
+        double diff = rolling->values[i] - mean;
+        if (!isnan(diff)) {
+            m2 += diff * diff;
+        }
+    }
+
+    rolling->count = count;
+    rolling->sum = sum;
+    rolling->mean = mean;
+    rolling->m2 = m2;
+}
+
+// Function to create an empty rolling window
+int fscl_rolling_create(crolling *rolling, size_t window) {
+    memset(rolling, 0, sizeof(*rolling));
+    if (window == 0) {
+        return -1;
+    }
+
+    rolling->values = (double *)malloc(window * sizeof(double));
+    rolling->low = (uint64_t *)malloc(window * sizeof(uint64_t));
+    rolling->high = (uint64_t *)malloc(window * sizeof(uint64_t));
+    if (rolling->values == NULL || rolling->low == NULL || rolling->high == NULL) {
+        fscl_rolling_erase(rolling);
+        return -1;
+    }
+    rolling->window = window;
+    return 0;
+}
+
+// Function to erase a rolling window
+void fscl_rolling_erase(crolling *rolling) {
+    free(rolling->values);
+    free(rolling->low);
+    free(rolling->high);
+    memset(rolling, 0, sizeof(*rolling));
+}
+
+// Function to push one sample
+void fscl_rolling_push(crolling *rolling, double value) {
+    size_t window = rolling->window;
+    uint64_t sample = rolling->pushed;
+
+    // Evict the oldest sample from the sums and the deques
+    if (sample >= window) {
+        uint64_t oldest = sample - window;
+        double old = fscl_rolling_value(rolling, oldest);
+        if (!isnan(old)) {
+            if (--rolling->count == 0) {
+                rolling->sum = 0.0;
+                rolling->mean = 0.0;
+                rolling->m2 = 0.0;
+            } else {
+                double delta = old - rolling->mean;
+                rolling->sum -= old;
+                rolling->mean -= delta / (double)rolling->count;
+                rolling->m2 -= delta * (old - rolling->mean);
+                if (rolling->m2 < 0.0) rolling->m2 = 0.0;
+            }
+        }
+        if (rolling->low_size > 0 && rolling->low[rolling->low_head] == oldest) {
+            rolling->low_head = (rolling->low_head + 1) % window;
+            --rolling->low_size;
+        }
+        if (rolling->high_size > 0 && rolling->high[rolling->high_head] == oldest) {
+            rolling->high_head = (rolling->high_head + 1) % window;
+            --rolling->high_size;
+        }
+    }
+
+    rolling->values[sample % window] = value;
+    rolling->pushed = sample + 1;
+
+    if (!isnan(value)) {
+        double delta = value - rolling->mean;
+        ++rolling->count;
+        rolling->sum += value;
+        rolling->mean += delta / (double)rolling->count;
+        rolling->m2 += delta * (value - rolling->mean);
+
+        // Drop samples from the back that can never be the min (or max) again
+        while (rolling->low_size > 0 &&
+               fscl_rolling_value(rolling, rolling->low[(rolling->low_head + rolling->low_size - 1) % window]) >= value) {
+            --rolling->low_size;
+        }
+        rolling->low[(rolling->low_head + rolling->low_size++) % window] = sample;
+        while (rolling->high_size > 0 &&
+               fscl_rolling_value(rolling, rolling->high[(rolling->high_head + rolling->high_size - 1) % window]) <= value) {
+            --rolling->high_size;
+        }
+        rolling->high[(rolling->high_head + rolling->high_size++) % window] = sample;
+    }
+
+    if (rolling->pushed % window == 0) {
+        fscl_rolling_recompute(rolling);
+    }
+}
+
+// Function to get the statistics of the window
+void fscl_rolling_stats(const crolling *rolling, cdataset_stats *stats) {
+    size_t size = rolling->pushed < rolling->window ? (size_t)rolling->pushed : rolling->window;
+    stats->count = rolling->count;
+    stats->nan_count = size - rolling->count;
+    stats->sum = rolling->sum;
+
+    if (rolling->count == 0) {
+        stats->mean = NAN;
+        stats->variance = NAN;
+        stats->min = NAN;
+        stats->max = NAN;
+        return;
+    }
+    stats->mean = rolling->mean;
+    stats->variance = rolling->m2 / (double)rolling->count;
+    stats->min = fscl_rolling_value(rolling, rolling->low[rolling->low_head]);
+    stats->max = fscl_rolling_value(rolling, rolling->high[rolling->high_head]);
+}
+
+// Shared state of fscl_data_rolling
+typedef struct {
+    const double *data;
+    double *result;
+    size_t window;
+    crolling_stat stat;
+    int failed;
+} crolling_job;
+
+static void fscl_rolling_chunk(void *context, size_t begin, size_t end) {
+    crolling_job *job = (crolling_job *)context;
+    crolling rolling;
+    if (fscl_rolling_create(&rolling, job->window) != 0) {
+        job->failed = 1;
+        return;
+    }
+
+    // Warm up with the elements of the first window that precede the chunk
+    size_t first = begin >= job->window - 1 ? begin - (job->window - 1) : 0;
+    for (size_t i = first; i < begin; ++i) {
+        fscl_rolling_push(&rolling, job->data[i]);
+    }
+
+    cdataset_stats stats;
+    for (size_t i = begin; i < end; ++i) {
+        fscl_rolling_push(&rolling, job->data[i]);
+        fscl_rolling_stats(&rolling, &stats);
+        switch (job->stat) {
+            case FSCL_ROLLING_MEAN:     job->result[i] = stats.mean; break;
+            case FSCL_ROLLING_VARIANCE: job->result[i] = stats.variance; break;
+            case FSCL_ROLLING_STD_DEV:  job->result[i] = sqrt(stats.variance); break;
+            case FSCL_ROLLING_MIN:      job->result[i] = stats.min; break;
+            case FSCL_ROLLING_MAX:      job->result[i] = stats.max; break;
+        }
+    }
+    fscl_rolling_erase(&rolling);
+}
+
+// Function to compute a trailing-window statistic for every element
+int fscl_data_rolling(const cdataset *dataset, size_t window, crolling_stat stat, cdataset *result) {
+    if (window == 0) {
+        return -1;
+    }
+    fscl_data_create(result, dataset->size);
+    if (result->data == NULL && dataset->size > 0) {
+        return -1;
+    }
+
+    crolling_job job = {dataset->data, result->data, window, stat, 0};
+    size_t grain = window <= FSCL_ROLLING_CHUNK / 4 ? FSCL_ROLLING_CHUNK : dataset->size;
+    fscl_data_for(FSCL_DATA_EXEC_DEFAULT, dataset->size, grain, fscl_rolling_chunk, &job);
+
+    if (job.failed) {
+        fscl_data_erase(result);
+        return -1;
+    }
+    return 0;
+}
@@ -0,0 +1,297 @@
+/*
+==============================================================================
+Author: Michael Gene Brockus (Dreamer)
+Email: michaelbrockus@gmail.com
+Organization: Fossil Logic
+Description: 
+    This file is part of the Fossil Logic project, where innovation meets
+    excellence in software development. Michael Gene Brockus, also known as
+    "Dreamer," is a dedicated contributor to this project. For any inquiries,
+    feel free to contact Michael at michaelbrockus@gmail.com.
+==============================================================================
+*/
+#include "fossil/xscience/sort.h"
+#include "fossil/xscience/parallel.h"
+#include <string.h>
+#include <stdint.h>
+
+// Smallest chunk handed to a thread
+#define FSCL_SORT_CHUNK ((size_t)1 << 16)
+
+// Eight passes over byte-sized digits
+#define FSCL_SORT_DIGITS 8
+#define FSCL_SORT_RADIX 256
+
+#define FSCL_SORT_SIGN 0x8000000000000000ull
+
+// Shared state of one radix sort
+typedef struct {
+    uint64_t *keys;
+    uint64_t *keys_out;
+    size_t *items;        // moved along with the keys, or NULL
+    size_t *items_out;
+    size_t *counts;       // per chunk: all digits on the first pass, one after
+    size_t grain;
+    unsigned shift;
+} csort_job;
+
+// Function to map a double to an unsigned key with the same order
+static uint64_t fscl_sort_key(double value) {
+    uint64_t bits;
+    memcpy(&bits, &value, sizeof(bits));
+    return (bits & FSCL_SORT_SIGN) ? ~bits : bits | FSCL_SORT_SIGN;
+}
+
+// Function to map a key back to its double
+static double fscl_sort_value(uint64_t key) {
+    uint64_t bits = (key & FSCL_SORT_SIGN) ? key ^ FSCL_SORT_SIGN : ~key;
+    double value;
+    memcpy(&value, &bits, sizeof(value));
+    return value;
+}
+
+// Function to count every digit of a chunk
+static void fscl_sort_count_all(void *context, size_t begin, size_t end) {
+    csort_job *job = (csort_job *)context;
+    size_t *counts = job->counts + (begin / job->grain) * FSCL_SORT_DIGITS * FSCL_SORT_RADIX;
+    memset(counts, 0, FSCL_SORT_DIGITS * FSCL_SORT_RADIX * sizeof(size_t));
+    for (size_t i = begin; i < end; ++i) {
+        uint64_t key = job->keys[i];
+        for (unsigned d = 0; d < FSCL_SORT_DIGITS; ++d) {
+            counts[d * FSCL_SORT_RADIX + ((key >> (8 * d)) & 0xff)]++;
+        }
+    }
+}
+
+// Function to count the current digit of a chunk
+static void fscl_sort_count(void *context, size_t begin, size_t end) {
+    csort_job *job = (csort_job *)context;
+    size_t *counts = job->counts + (begin / job->grain) * FSCL_SORT_RADIX;
+    memset(counts, 0, FSCL_SORT_RADIX * sizeof(size_t));
+    for (size_t i = begin; i < end; ++i) {
+        counts[(job->keys[i] >> job->shift) & 0xff]++;
+    }
+}
+
+// Function to move the keys of a chunk to their offsets; the chunk keeps
+// its order within every digit, which makes the sort stable
+static void fscl_sort_scatter(void *context, size_t begin, size_t end) {
+    csort_job *job = (csort_job *)context;
+    size_t *offsets = job->counts + (begin / job->grain) * FSCL_SORT_RADIX;
+    if (job->items == NULL) {
+        for (size_t i = begin; i < end; ++i) {
+            uint64_t key = job->keys[i];
+            job->keys_out[offsets[(key >> job->shift) & 0xff]++] = key;
+        }
+        return;
+    }
+    for (size_t i = begin; i < end; ++i) {
+        uint64_t key = job->keys[i];
+        size_t position = offsets[(key >> job->shift) & 0xff]++;
+        job->keys_out[position] = key;
+        job->items_out[position] = job->items[i];
+    }
+}
+
+// Function to sort keys in place, moving items (if any) along with them
+static int fscl_sort_radix(uint64_t *keys, size_t *items, size_t size) {
+    if (size < 2) {
+        return 0;
+    }
+
+    csort_job job = {keys, NULL, items, NULL, NULL, size, 0};
+    if (size > FSCL_SORT_CHUNK && fscl_data_parallel(FSCL_DATA_EXEC_DEFAULT)) {
+        size_t threads = fscl_parallel_get_threads();
+        job.grain = (size + threads - 1) / threads;
+        if (job.grain < FSCL_SORT_CHUNK) {
+            job.grain = FSCL_SORT_CHUNK;
+        }
+    }
+    size_t chunks = (size + job.grain - 1) / job.grain;
+
+    uint64_t *keys_scratch = (uint64_t *)malloc(size * sizeof(uint64_t));
+    size_t *items_scratch = items != NULL ? (size_t *)malloc(size * sizeof(size_t)) : NULL;
+    job.counts = (size_t *)malloc(chunks * FSCL_SORT_DIGITS * FSCL_SORT_RADIX * sizeof(size_t));
+    if (keys_scratch == NULL || (items != NULL && items_scratch == NULL) || job.counts == NULL) {
+        fprintf(stderr, "Error: Memory allocation failed\n");
+        free(keys_scratch);
+        free(items_scratch);
+        free(job.counts);
+        return -1;
+    }
+    job.keys_out = keys_scratch;
+    job.items_out = items_scratch;
+
+    // One read gives the totals of every digit; a digit shared by all
+    // keys would leave them in place and is skipped
+    size_t totals[FSCL_SORT_DIGITS][FSCL_SORT_RADIX];
+    fscl_data_for(FSCL_DATA_EXEC_DEFAULT, size, job.grain, fscl_sort_count_all, &job);
+    memset(totals, 0, sizeof(totals));
+    for (size_t c = 0; c < chunks; ++c) {
+        const size_t *counts = job.counts + c * FSCL_SORT_DIGITS * FSCL_SORT_RADIX;
+        for (size_t j = 0; j < FSCL_SORT_DIGITS * FSCL_SORT_RADIX; ++j) {
+            totals[j / FSCL_SORT_RADIX][j % FSCL_SORT_RADIX] += counts[j];
+        }
+    }
+
+    for (unsigned d = 0; d < FSCL_SORT_DIGITS; ++d) {
+        int trivial = 0;
+        for (size_t b = 0; b < FSCL_SORT_RADIX; ++b) {
+            trivial |= totals[d][b] == size;
+        }
+        if (trivial) {
+            continue;
+        }
+
+        job.shift = 8 * d;
+        if (chunks > 1) {
+            fscl_data_for(FSCL_DATA_EXEC_DEFAULT, size, job.grain, fscl_sort_count, &job);
+        } else {
+            memcpy(job.counts, totals[d], sizeof(totals[d]));
+        }
+
+        // Digit-major, chunks in order: every chunk writes after the
+        // chunks before it within each digit
+        size_t running = 0;
+        for (size_t b = 0; b < FSCL_SORT_RADIX; ++b) {
+            for (size_t c = 0; c < chunks; ++c) {
+                size_t count = job.counts[c * FSCL_SORT_RADIX + b];
+                job.counts[c * FSCL_SORT_RADIX + b] = running;
+                running += count;
+            }
+        }
+        fscl_data_for(FSCL_DATA_EXEC_DEFAULT, size, job.grain, fscl_sort_scatter, &job);
+
+        uint64_t *swap_keys = job.keys;
+        job.keys = job.keys_out;
+        job.keys_out = swap_keys;
+        size_t *swap_items = job.items;
+        job.items = job.items_out;
+        job.items_out = swap_items;
+    }
+
+    if (job.keys != keys) {
+        memcpy(keys, job.keys, size * sizeof(uint64_t));
+        if (items != NULL) {
+            memcpy(items, job.items, size * sizeof(size_t));
+        }
+    }
+    free(keys_scratch);
+    free(items_scratch);
+    free(job.counts);
+    return 0;
+}
+
+// Function to count the NaN values of a dataset
+static size_t fscl_sort_count_nan(const cdataset *dataset) {
+    size_t nans = 0;
+    for (size_t i = 0; i < dataset->size; ++i) {
+        nans += isnan(dataset->data[i]) != 0;
+    }
+    return nans;
+}
+
+// Function to sort a dataset in place
+int fscl_data_sort(cdataset *dataset, csort_nan nan_policy) {
+    size_t size = dataset->size;
+    uint64_t *keys = (uint64_t *)malloc((size > 0 ? size : 1) * sizeof(uint64_t));
+    if (keys == NULL) {
+        fprintf(stderr, "Error: Memory allocation failed\n");
+        return -1;
+    }
+
+    // NaN values keep their bit patterns in their own region of keys
+    size_t nans = fscl_sort_count_nan(dataset);
+    size_t first = nan_policy == FSCL_SORT_NAN_FIRST ? nans : 0;
+    size_t nan_first = nan_policy == FSCL_SORT_NAN_FIRST ? 0 : size - nans;
+    size_t n = first, m = nan_first;
+    for (size_t i = 0; i < size; ++i) {
+        double value = dataset->data[i];
+        if (isnan(value)) {
+            memcpy(&keys[m++], &value, sizeof(double));
+        } else {
+            keys[n++] = fscl_sort_key(value);
+        }
+    }
+
+    if (fscl_sort_radix(keys + first, NULL, size - nans) != 0) {
+        free(keys);
+        return -1;
+    }
+
+    fscl_data_index_drop(dataset);
+    for (size_t i = 0; i < size; ++i) {
+        if (i >= nan_first && i < nan_first + nans) {
+            memcpy(&dataset->data[i], &keys[i], sizeof(double));
+        } else {
+            dataset->data[i] = fscl_sort_value(keys[i]);
+        }
+    }
+    free(keys);
+    fscl_data_zones_update(dataset, 0, size);
+    return 0;
+}
+
+// Function to compute the sorting order of a dataset
+int fscl_data_argsort(const cdataset *dataset, csort_nan nan_policy, size_t *order) {
+    size_t size = dataset->size;
+    size_t nans = fscl_sort_count_nan(dataset);
+    uint64_t *keys = (uint64_t *)malloc((size - nans > 0 ? size - nans : 1) * sizeof(uint64_t));
+    if (keys == NULL) {
+        fprintf(stderr, "Error: Memory allocation failed\n");
+        return -1;
+    }
+
+    size_t first = nan_policy == FSCL_SORT_NAN_FIRST ? nans : 0;
+    size_t n = 0, m = nan_policy == FSCL_SORT_NAN_FIRST ? 0 : size - nans;
+    for (size_t i = 0; i < size; ++i) {
+        double value = dataset->data[i];
+        if (isnan(value)) {
+            order[m++] = i;
+        } else {
+            keys[n] = fscl_sort_key(value);
+            order[first + n++] = i;
+        }
+    }
+
+    int status = fscl_sort_radix(keys, order + first, n);
+    free(keys);
+    return status;
+}
+
+// Function to rank the elements of a dataset
+int fscl_data_rank(const cdataset *dataset, cdataset *ranks) {
+    size_t size = dataset->size;
+    size_t *order = (size_t *)malloc((size > 0 ? size : 1) * sizeof(size_t));
+    fscl_data_create(ranks, size);
+    if (order == NULL || (ranks->data == NULL && size > 0)) {
+        fprintf(stderr, "Error: Memory allocation failed\n");
+        free(order);
+        fscl_data_erase(ranks);
+        return -1;
+    }
+    if (fscl_data_argsort(dataset, FSCL_SORT_NAN_LAST, order) != 0) {
+        free(order);
+        fscl_data_erase(ranks);
+        return -1;
+    }
+
+    size_t n = size - fscl_sort_count_nan(dataset);
+    for (size_t i = 0; i < n;) {
+        double value = dataset->data[order[i]];
+        size_t j = i + 1;
+        while (j < n && dataset->data[order[j]] == value) {
+            ++j;
+        }
+        // Ranks i + 1 .. j share their average
+        double rank = (double)(i + 1 + j) / 2.0;
+        for (; i < j; ++i) {
+            ranks->data[order[i]] = rank;
+        }
+    }
+    for (size_t i = n; i < size; ++i) {
+        ranks->data[order[i]] = NAN;
+    }
+    free(order);
+    return 0;
+}
@@ -0,0 +1,314 @@
+/*
+==============================================================================
+Author: Michael Gene Brockus (Dreamer)
+Email: michaelbrockus@gmail.com
+Organization: Fossil Logic
+Description: 
+    This file is part of the Fossil Logic project, where innovation meets
+    excellence in software development. Michael Gene Brockus, also known as
+    "Dreamer," is a dedicated contributor to this project. For any inquiries,
+    feel free to contact Michael at michaelbrockus@gmail.com.
+==============================================================================
+*/
+#include "fossil/xscience/sparse.h"
+#include "fossil/xscience/parallel.h"
+#include <string.h>
+
+// Rows per chunk of the parallel row loops
+#define FSCL_SPARSE_CHUNK ((size_t)1 << 12)
+
+// Column and value of one entry while sorting a row
+typedef struct {
+    size_t column;
+    double value;
+} csparse_entry;
+
+typedef struct {
+    const csparse *matrix;
+    const double *vector;
+    double *result;
+} csparse_job;
+
+// Function to create a matrix with empty rows
+int fscl_sparse_create(csparse *matrix, size_t rows, size_t cols, size_t nnz) {
+    memset(matrix, 0, sizeof(*matrix));
+    matrix->values = (double *)malloc((nnz > 0 ? nnz : 1) * sizeof(double));
+    matrix->columns = (size_t *)malloc((nnz > 0 ? nnz : 1) * sizeof(size_t));
+    matrix->row_start = (size_t *)calloc(rows + 1, sizeof(size_t));
+    if (matrix->values == NULL || matrix->columns == NULL || matrix->row_start == NULL) {
+        fprintf(stderr, "Error: Memory allocation failed\n");
+        fscl_sparse_erase(matrix);
+        return -1;
+    }
+    matrix->rows = rows;
+    matrix->cols = cols;
+    matrix->nnz = nnz;
+    return 0;
+}
+
+// Function to erase a matrix
+void fscl_sparse_erase(csparse *matrix) {
+    free(matrix->values);
+    free(matrix->columns);
+    free(matrix->row_start);
+    memset(matrix, 0, sizeof(*matrix));
+}
+
+static int fscl_sparse_compare(const void *a, const void *b) {
+    size_t x = ((const csparse_entry *)a)->column, y = ((const csparse_entry *)b)->column;
+    return (x > y) - (x < y);
+}
+
+// Function to build a matrix from COO triplets
+int fscl_sparse_from_coo(csparse *matrix, size_t rows, size_t cols, const size_t *row_index,
+                         const size_t *col_index, const double *values, size_t count) {
+    for (size_t i = 0; i < count; ++i) {
+        if (row_index[i] >= rows || col_index[i] >= cols) {
+            memset(matrix, 0, sizeof(*matrix));
+            fprintf(stderr, "Error: Sparse index out of range\n");
+            return -1;
+        }
+    }
+
+    csparse_entry *entries = (csparse_entry *)malloc((count > 0 ? count : 1) * sizeof(csparse_entry));
+    if (entries == NULL || fscl_sparse_create(matrix, rows, cols, count) != 0) {
+        free(entries);
+        memset(matrix, 0, sizeof(*matrix));
+        return -1;
+    }
+
+    // Counting sort by row, then sort each row by column
+    size_t *start = matrix->row_start;
+    for (size_t i = 0; i < count; ++i) {
+        start[row_index[i] + 1]++;
+    }
+    for (size_t r = 0; r < rows; ++r) {
+        start[r + 1] += start[r];
+    }
+    for (size_t i = 0; i < count; ++i) {
+        csparse_entry *entry = &entries[start[row_index[i]]++];
+        entry->column = col_index[i];
+        entry->value = values[i];
+    }
+
+    // The scatter moved every start to the end of its row; walk back
+    size_t nnz = 0, first = 0;
+    for (size_t r = 0; r < rows; ++r) {
+        size_t last = start[r];
+        qsort(entries + first, last - first, sizeof(csparse_entry), fscl_sparse_compare);
+        start[r] = nnz;
+        for (size_t i = first; i < last; ++i) {
+            if (nnz > start[r] && matrix->columns[nnz - 1] == entries[i].column) {
+                matrix->values[nnz - 1] += entries[i].value;
+            } else {
+                matrix->columns[nnz] = entries[i].column;
+                matrix->values[nnz] = entries[i].value;
+                ++nnz;
+            }
+        }
+        first = last;
+    }
+    start[rows] = nnz;
+    matrix->nnz = nnz;
+    free(entries);
+    return 0;
+}
+
+// Function to build a matrix from a row-major dense matrix
+int fscl_sparse_from_dense(csparse *matrix, const cdataset *dataset, size_t num_features) {
+    if (num_features == 0 || dataset->size % num_features != 0) {
+        memset(matrix, 0, sizeof(*matrix));
+        fprintf(stderr, "Error: Dataset size must be a multiple of the number of features\n");
+        return -1;
+    }
+
+    size_t nnz = 0;
+    for (size_t i = 0; i < dataset->size; ++i) {
+        nnz += dataset->data[i] != 0.0;
+    }
+
+    size_t rows = dataset->size / num_features;
+    if (fscl_sparse_create(matrix, rows, num_features, nnz) != 0) {
+        return -1;
+    }
+    size_t n = 0;
+    for (size_t r = 0; r < rows; ++r) {
+        matrix->row_start[r] = n;
+        const double *row = dataset->data + r * num_features;
+        for (size_t c = 0; c < num_features; ++c) {
+            if (row[c] != 0.0) {
+                matrix->columns[n] = c;
+                matrix->values[n] = row[c];
+                ++n;
+            }
+        }
+    }
+    matrix->row_start[rows] = n;
+    return 0;
+}
+
+// Function to expand a matrix into a dense dataset
+int fscl_sparse_to_dense(const csparse *matrix, cdataset *dataset) {
+    size_t size = matrix->rows * matrix->cols;
+    fscl_data_create(dataset, size);
+    if (dataset->data == NULL && size > 0) {
+        return -1;
+    }
+    memset(dataset->data, 0, size * sizeof(double));
+    for (size_t r = 0; r < matrix->rows; ++r) {
+        for (size_t k = matrix->row_start[r]; k < matrix->row_start[r + 1]; ++k) {
+            dataset->data[r * matrix->cols + matrix->columns[k]] = matrix->values[k];
+        }
+    }
+    return 0;
+}
+
+// Function to scale the stored entries
+void fscl_sparse_scale(csparse *matrix, double factor) {
+    cdataset view = {matrix->values, matrix->nnz, NULL};
+    fscl_data_scale(&view, factor);
+}
+
+// Function to sum the stored entries
+double fscl_sparse_sum(const csparse *matrix) {
+    cdataset view = {matrix->values, matrix->nnz, NULL};
+    return fscl_data_sum(&view);
+}
+
+static void fscl_sparse_dot_chunk(void *context, size_t begin, size_t end) {
+    csparse_job *job = (csparse_job *)context;
+    const csparse *matrix = job->matrix;
+    for (size_t r = begin; r < end; ++r) {
+        double sum = 0.0;
+        for (size_t k = matrix->row_start[r]; k < matrix->row_start[r + 1]; ++k) {
+            sum += matrix->values[k] * job->vector[matrix->columns[k]];
+        }
+        job->result[r] = sum;
+    }
+}
+
+// Function to compute the dot product of every row with a vector
+int fscl_sparse_dot_product(const csparse *matrix, const cdataset *vector, cdataset *result) {
+    if (vector->size != matrix->cols) {
+        fprintf(stderr, "Error: Vector size must match the number of columns\n");
+        return -1;
+    }
+    fscl_data_create(result, matrix->rows);
+    if (result->data == NULL && matrix->rows > 0) {
+        return -1;
+    }
+
+    csparse_job job = {matrix, vector->data, result->data};
+    fscl_data_for(FSCL_DATA_EXEC_DEFAULT, matrix->rows, FSCL_SPARSE_CHUNK, fscl_sparse_dot_chunk, &job);
+    return 0;
+}
+
+static int fscl_categorical_compare(const void *a, const void *b) {
+    double x = *(const double *)a, y = *(const double *)b;
+    return (x > y) - (x < y);
+}
+
+// Function to dictionary-encode a dataset
+int fscl_categorical_encode(ccategorical *column, const cdataset *dataset) {
+    memset(column, 0, sizeof(*column));
+    size_t size = dataset->size;
+    column->dictionary = (double *)malloc((size > 0 ? size : 1) * sizeof(double));
+    column->codes = (uint32_t *)malloc((size > 0 ? size : 1) * sizeof(uint32_t));
+    if (column->dictionary == NULL || column->codes == NULL) {
+        fprintf(stderr, "Error: Memory allocation failed\n");
+        fscl_categorical_erase(column);
+        return -1;
+    }
+    column->size = size;
+
+    // Sort a copy of the values and keep each distinct one once
+    size_t count = 0;
+    for (size_t i = 0; i < size; ++i) {
+        if (!isnan(dataset->data[i])) {
+            column->dictionary[count++] = dataset->data[i];
+        }
+    }
+    qsort(column->dictionary, count, sizeof(double), fscl_categorical_compare);
+    size_t distinct = 0;
+    for (size_t i = 0; i < count; ++i) {
+        if (distinct == 0 || column->dictionary[distinct - 1] != column->dictionary[i]) {
+            column->dictionary[distinct++] = column->dictionary[i];
+        }
+    }
+    if (distinct >= FSCL_CATEGORY_MISSING) {
+        fprintf(stderr, "Error: Too many categories\n");
+        fscl_categorical_erase(column);
+        return -1;
+    }
+    column->num_categories = distinct;
+
+    double *dictionary = (double *)realloc(column->dictionary, (distinct > 0 ? distinct : 1) * sizeof(double));
+    if (dictionary != NULL) {
+        column->dictionary = dictionary;
+    }
+
+    for (size_t i = 0; i < size; ++i) {
+        double value = dataset->data[i];
+        if (isnan(value)) {
+            column->codes[i] = FSCL_CATEGORY_MISSING;
+            continue;
+        }
+        size_t low = 0, high = distinct;
+        while (high - low > 1) {
+            size_t middle = low + (high - low) / 2;
+            if (column->dictionary[middle] <= value) {
+                low = middle;
+            } else {
+                high = middle;
+            }
+        }
+        column->codes[i] = (uint32_t)low;
+    }
+    return 0;
+}
+
+// Function to erase a categorical column
+void fscl_categorical_erase(ccategorical *column) {
+    free(column->dictionary);
+    free(column->codes);
+    memset(column, 0, sizeof(*column));
+}
+
+// Function to one-hot encode a categorical column as a sparse matrix
+int fscl_categorical_one_hot(const ccategorical *column, csparse *matrix) {
+    size_t nnz = 0;
+    for (size_t i = 0; i < column->size; ++i) {
+        nnz += column->codes[i] != FSCL_CATEGORY_MISSING;
+    }
+    if (fscl_sparse_create(matrix, column->size, column->num_categories, nnz) != 0) {
+        return -1;
+    }
+
+    size_t n = 0;
+    for (size_t i = 0; i < column->size; ++i) {
+        matrix->row_start[i] = n;
+        if (column->codes[i] != FSCL_CATEGORY_MISSING) {
+            matrix->columns[n] = column->codes[i];
+            matrix->values[n] = 1.0;
+            ++n;
+        }
+    }
+    matrix->row_start[column->size] = n;
+    return 0;
+}
+
+// Function to one-hot encode a dataset straight into a sparse matrix
+int fscl_data_one_hot_sparse(const cdataset *dataset, csparse *matrix, ccategorical *column) {
+    ccategorical local;
+    ccategorical *encoded = column != NULL ? column : &local;
+
+    if (fscl_categorical_encode(encoded, dataset) != 0) {
+        memset(matrix, 0, sizeof(*matrix));
+        return -1;
+    }
+    int status = fscl_categorical_one_hot(encoded, matrix);
+    if (column == NULL || status != 0) {
+        fscl_categorical_erase(encoded);
+    }
+    return status;
+}
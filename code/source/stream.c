@@ -0,0 +1,152 @@
+/*
+==============================================================================
+Author: Michael Gene Brockus (Dreamer)
+Email: michaelbrockus@gmail.com
+Organization: Fossil Logic
+Description: 
+    This file is part of the Fossil Logic project, where innovation meets
+    excellence in software development. Michael Gene Brockus, also known as
+    "Dreamer," is a dedicated contributor to this project. For any inquiries,
+    feel free to contact Michael at michaelbrockus@gmail.com.
+==============================================================================
+*/
+#include "fossil/xscience/stream.h"
+#include <string.h>
+
+// Cache-line aligned ring; MSVC and MinGW have no aligned_alloc
+#if defined(_WIN32)
+#include <malloc.h>
+#define fscl_stream_alloc(bytes) _aligned_malloc(bytes, FSCL_STREAM_LINE)
+#define fscl_stream_free(pointer) _aligned_free(pointer)
+#else
+#define fscl_stream_alloc(bytes) aligned_alloc(FSCL_STREAM_LINE, bytes)
+#define fscl_stream_free(pointer) free(pointer)
+#endif
+
+// Function to create an empty stream
+int fscl_stream_create(cstream *stream, size_t capacity) {
+    memset(stream, 0, sizeof(*stream));
+    if (capacity == 0 || capacity > ((size_t)-1 >> 1) / sizeof(double)) {
+        return -1;
+    }
+
+    size_t size = 1;
+    while (size < capacity) {
+        size <<= 1;
+    }
+    size_t bytes = size * sizeof(double);
+    if (bytes < FSCL_STREAM_LINE) {
+        bytes = FSCL_STREAM_LINE;
+    }
+
+    stream->data = (double *)fscl_stream_alloc(bytes);
+    if (stream->data == NULL) {
+        fprintf(stderr, "Error: Memory allocation failed\n");
+        return -1;
+    }
+    stream->capacity = size;
+    atomic_init(&stream->head, 0);
+    atomic_init(&stream->tail, 0);
+    return 0;
+}
+
+// Function to erase a stream
+void fscl_stream_erase(cstream *stream) {
+    fscl_stream_free(stream->data);
+    stream->data = NULL;
+    stream->capacity = 0;
+    atomic_store_explicit(&stream->head, 0, memory_order_relaxed);
+    atomic_store_explicit(&stream->tail, 0, memory_order_relaxed);
+    stream->cached_tail = 0;
+    stream->cached_head = 0;
+}
+
+// Function to append samples (producer)
+size_t fscl_stream_push(cstream *stream, const double *values, size_t count) {
+    size_t head = atomic_load_explicit(&stream->head, memory_order_relaxed);
+    size_t space = stream->capacity - (head - stream->cached_tail);
+    if (space < count) {
+        stream->cached_tail = atomic_load_explicit(&stream->tail, memory_order_acquire);
+        space = stream->capacity - (head - stream->cached_tail);
+    }
+    if (count > space) {
+        count = space;
+    }
+    if (count == 0) {
+        return 0;
+    }
+
+    size_t start = head & (stream->capacity - 1);
+    size_t first = stream->capacity - start < count ? stream->capacity - start : count;
+    memcpy(stream->data + start, values, first * sizeof(double));
+    memcpy(stream->data, values + first, (count - first) * sizeof(double));
+    atomic_store_explicit(&stream->head, head + count, memory_order_release);
+    return count;
+}
+
+// Function to expose the unconsumed samples as contiguous views (consumer)
+size_t fscl_stream_views(cstream *stream, cdataset views[2]) {
+    size_t tail = atomic_load_explicit(&stream->tail, memory_order_relaxed);
+    stream->cached_head = atomic_load_explicit(&stream->head, memory_order_acquire);
+    size_t available = stream->cached_head - tail;
+    size_t start = tail & (stream->capacity - 1);
+    size_t first = stream->capacity - start < available ? stream->capacity - start : available;
+
+    views[0] = (cdataset){stream->data + start, first, NULL};
+    views[1] = (cdataset){stream->data, available - first, NULL};
+    return (first > 0) + (available > first);
+}
+
+// Function to release the oldest samples (consumer)
+size_t fscl_stream_consume(cstream *stream, size_t count) {
+    size_t tail = atomic_load_explicit(&stream->tail, memory_order_relaxed);
+    if (stream->cached_head - tail < count) {
+        stream->cached_head = atomic_load_explicit(&stream->head, memory_order_acquire);
+        if (stream->cached_head - tail < count) {
+            count = stream->cached_head - tail;
+        }
+    }
+    atomic_store_explicit(&stream->tail, tail + count, memory_order_release);
+    return count;
+}
+
+// Function to copy and release the oldest samples (consumer)
+size_t fscl_stream_pop(cstream *stream, double *values, size_t count) {
+    size_t tail = atomic_load_explicit(&stream->tail, memory_order_relaxed);
+    if (stream->cached_head - tail < count) {
+        stream->cached_head = atomic_load_explicit(&stream->head, memory_order_acquire);
+    }
+    if (count > stream->cached_head - tail) {
+        count = stream->cached_head - tail;
+    }
+    if (count == 0) {
+        return 0;
+    }
+
+    size_t start = tail & (stream->capacity - 1);
+    size_t first = stream->capacity - start < count ? stream->capacity - start : count;
+    memcpy(values, stream->data + start, first * sizeof(double));
+    memcpy(values + first, stream->data, (count - first) * sizeof(double));
+    atomic_store_explicit(&stream->tail, tail + count, memory_order_release);
+    return count;
+}
+
+// Function to get the number of unconsumed samples
+size_t fscl_stream_size(const cstream *stream) {
+    size_t tail = atomic_load_explicit(&stream->tail, memory_order_acquire);
+    size_t head = atomic_load_explicit(&stream->head, memory_order_acquire);
+    return head - tail;
+}
+
+// Function to compute statistics of the unconsumed samples (consumer)
+void fscl_stream_stats(cstream *stream, cdataset_stats *stats) {
+    cdataset views[2];
+    cdataset_stats part;
+
+    fscl_stream_views(stream, views);
+    fscl_data_stats(&views[0], stats);
+    if (views[1].size > 0) {
+        fscl_data_stats(&views[1], &part);
+        fscl_data_stats_merge(stats, &part);
+    }
+}
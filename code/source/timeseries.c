@@ -0,0 +1,340 @@
+/*
+==============================================================================
+Author: Michael Gene Brockus (Dreamer)
+Email: michaelbrockus@gmail.com
+Organization: Fossil Logic
+Description: 
+    This file is part of the Fossil Logic project, where innovation meets
+    excellence in software development. Michael Gene Brockus, also known as
+    "Dreamer," is a dedicated contributor to this project. For any inquiries,
+    feel free to contact Michael at michaelbrockus@gmail.com.
+==============================================================================
+*/
+#include "fossil/xscience/timeseries.h"
+#include <string.h>
+
+// Bit stream written most significant bit first; a NULL words pointer
+// only counts bits, which is how a block sizes both predictors
+typedef struct {
+    uint64_t *words;
+    size_t allocated;   // capacity in words
+    uint64_t length;    // bits written
+    int failed;
+} cseries_writer;
+
+typedef struct {
+    const uint64_t *words;
+    uint64_t position;
+} cseries_reader;
+
+// XOR window carried between values: leading zeros and meaningful bits
+typedef struct {
+    unsigned leading;
+    unsigned width;
+} cseries_window;
+
+static uint64_t fscl_series_bits(double value) {
+    uint64_t bits;
+    memcpy(&bits, &value, sizeof(bits));
+    return bits;
+}
+
+static double fscl_series_value(uint64_t bits) {
+    double value;
+    memcpy(&value, &bits, sizeof(value));
+    return value;
+}
+
+static unsigned fscl_series_clz(uint64_t x) {
+#if defined(__GNUC__) || defined(__clang__)
+    return (unsigned)__builtin_clzll(x);
+#else
+    unsigned n = 0;
+    while (!(x & 0x8000000000000000ull)) {
+        x <<= 1;
+        ++n;
+    }
+    return n;
+#endif
+}
+
+static unsigned fscl_series_ctz(uint64_t x) {
+#if defined(__GNUC__) || defined(__clang__)
+    return (unsigned)__builtin_ctzll(x);
+#else
+    unsigned n = 0;
+    while (!(x & 1)) {
+        x >>= 1;
+        ++n;
+    }
+    return n;
+#endif
+}
+
+// Function to append the low `count` bits of value (1 <= count <= 64)
+static void fscl_series_write(cseries_writer *writer, uint64_t value, unsigned count) {
+    if (writer->words == NULL && writer->allocated == 0) {
+        writer->length += count;
+        return;
+    }
+
+    size_t needed = (size_t)((writer->length + count + 63) / 64);
+    if (needed > writer->allocated) {
+        size_t allocated = writer->allocated * 2 > needed ? writer->allocated * 2 : needed;
+        uint64_t *words = (uint64_t *)realloc(writer->words, allocated * sizeof(uint64_t));
+        if (words == NULL) {
+            writer->failed = 1;
+            return;
+        }
+        memset(words + writer->allocated, 0, (allocated - writer->allocated) * sizeof(uint64_t));
+        writer->words = words;
+        writer->allocated = allocated;
+    }
+
+    if (count < 64) {
+        value &= ((uint64_t)1 << count) - 1;
+    }
+    size_t word = (size_t)(writer->length / 64);
+    unsigned used = (unsigned)(writer->length % 64);
+    unsigned room = 64 - used;
+    if (count <= room) {
+        writer->words[word] |= count == 64 ? value : value << (room - count);
+    } else {
+        writer->words[word] |= value >> (count - room);
+        writer->words[word + 1] |= value << (64 - (count - room));
+    }
+    writer->length += count;
+}
+
+// Function to read `count` bits (1 <= count <= 64)
+static uint64_t fscl_series_read(cseries_reader *reader, unsigned count) {
+    size_t word = (size_t)(reader->position / 64);
+    unsigned used = (unsigned)(reader->position % 64);
+    unsigned room = 64 - used;
+    uint64_t value;
+
+    if (count <= room) {
+        value = reader->words[word] << used;
+        value = count == 64 ? value : value >> (64 - count);
+    } else {
+        value = (reader->words[word] << used) >> (64 - count);
+        value |= reader->words[word + 1] >> (64 - (count - room));
+    }
+    reader->position += count;
+    return value;
+}
+
+// Function to predict the next value of a block
+static uint64_t fscl_series_predict(cseries_predictor predictor, double previous, double before) {
+    if (predictor == FSCL_SERIES_LINEAR) {
+        return fscl_series_bits(previous + (previous - before));
+    }
+    return fscl_series_bits(previous);
+}
+
+// Function to encode one block: the first value raw, then for each value
+// the XOR against the prediction as '0' (equal), '10' + bits inside the
+// previous window, or '11' + 6-bit leading zeros + 6-bit width - 1 + bits
+static void fscl_series_encode(cseries_writer *writer, const double *values, size_t size, cseries_predictor predictor) {
+    cseries_window window = {64, 0};
+
+    fscl_series_write(writer, fscl_series_bits(values[0]), 64);
+    for (size_t i = 1; i < size; ++i) {
+        double before = i > 1 ? values[i - 2] : values[0];
+        uint64_t delta = fscl_series_bits(values[i]) ^ fscl_series_predict(predictor, values[i - 1], before);
+
+        if (delta == 0) {
+            fscl_series_write(writer, 0, 1);
+            continue;
+        }
+
+        unsigned leading = fscl_series_clz(delta);
+        unsigned trailing = fscl_series_ctz(delta);
+        if (window.width > 0 && leading >= window.leading && trailing >= 64 - window.leading - window.width) {
+            fscl_series_write(writer, 2, 2);
+            fscl_series_write(writer, delta >> (64 - window.leading - window.width), window.width);
+        } else {
+            window.leading = leading;
+            window.width = 64 - leading - trailing;
+            fscl_series_write(writer, 3, 2);
+            fscl_series_write(writer, leading, 6);
+            fscl_series_write(writer, window.width - 1, 6);
+            fscl_series_write(writer, delta >> trailing, window.width);
+        }
+    }
+}
+
+// Function to decode one block into values
+static void fscl_series_decode(cseries_reader *reader, double *values, size_t size, cseries_predictor predictor) {
+    cseries_window window = {64, 0};
+
+    values[0] = fscl_series_value(fscl_series_read(reader, 64));
+    for (size_t i = 1; i < size; ++i) {
+        double before = i > 1 ? values[i - 2] : values[0];
+        uint64_t predicted = fscl_series_predict(predictor, values[i - 1], before);
+
+        if (fscl_series_read(reader, 1) == 0) {
+            values[i] = fscl_series_value(predicted);
+            continue;
+        }
+        if (fscl_series_read(reader, 1) != 0) {
+            window.leading = (unsigned)fscl_series_read(reader, 6);
+            window.width = (unsigned)fscl_series_read(reader, 6) + 1;
+        }
+        uint64_t delta = fscl_series_read(reader, window.width) << (64 - window.leading - window.width);
+        values[i] = fscl_series_value(predicted ^ delta);
+    }
+}
+
+// Function to compress a dataset into a block-compressed series
+int fscl_series_compress(ctimeseries *series, const cdataset *dataset) {
+    memset(series, 0, sizeof(*series));
+    series->size = dataset->size;
+    series->num_blocks = (dataset->size + FSCL_SERIES_BLOCK - 1) / FSCL_SERIES_BLOCK;
+    if (series->num_blocks == 0) {
+        return 0;
+    }
+
+    series->blocks = (ctimeseries_block *)malloc(series->num_blocks * sizeof(ctimeseries_block));
+    if (series->blocks == NULL) {
+        return -1;
+    }
+
+    // Smooth data lands near 16 bits a value; the writer grows past that
+    cseries_writer writer = {NULL, 0, 0, 0};
+    writer.allocated = dataset->size / 4 + 1;
+    writer.words = (uint64_t *)calloc(writer.allocated, sizeof(uint64_t));
+    if (writer.words == NULL) {
+        fscl_series_erase(series);
+        return -1;
+    }
+
+    for (size_t b = 0; b < series->num_blocks; ++b) {
+        const double *values = dataset->data + b * FSCL_SERIES_BLOCK;
+        size_t size = dataset->size - b * FSCL_SERIES_BLOCK;
+        if (size > FSCL_SERIES_BLOCK) {
+            size = FSCL_SERIES_BLOCK;
+        }
+
+        cseries_writer previous = {NULL, 0, 0, 0}, linear = {NULL, 0, 0, 0};
+        fscl_series_encode(&previous, values, size, FSCL_SERIES_PREVIOUS);
+        fscl_series_encode(&linear, values, size, FSCL_SERIES_LINEAR);
+
+        ctimeseries_block *block = &series->blocks[b];
+        cdataset view = {(double *)values, size, NULL};
+        block->offset = writer.length;
+        block->size = size;
+        block->predictor = linear.length < previous.length ? FSCL_SERIES_LINEAR : FSCL_SERIES_PREVIOUS;
+        fscl_data_stats(&view, &block->stats);
+        fscl_series_encode(&writer, values, size, block->predictor);
+    }
+
+    series->bits = writer.words;
+    series->bit_length = writer.length;
+    if (writer.failed) {
+        fscl_series_erase(series);
+        return -1;
+    }
+
+    // Give back the slack of the initial estimate
+    size_t words = (size_t)((writer.length + 63) / 64);
+    uint64_t *bits = (uint64_t *)realloc(series->bits, (words > 0 ? words : 1) * sizeof(uint64_t));
+    if (bits != NULL) {
+        series->bits = bits;
+    }
+    return 0;
+}
+
+// Function to erase a series
+void fscl_series_erase(ctimeseries *series) {
+    free(series->bits);
+    free(series->blocks);
+    memset(series, 0, sizeof(*series));
+}
+
+// Function to compute the compressed size of a series
+size_t fscl_series_bytes(const ctimeseries *series) {
+    return (size_t)((series->bit_length + 63) / 64) * sizeof(uint64_t)
+        + series->num_blocks * sizeof(ctimeseries_block);
+}
+
+// Function to combine the block headers into statistics of the series
+void fscl_series_stats(const ctimeseries *series, cdataset_stats *stats) {
+    memset(stats, 0, sizeof(*stats));
+    for (size_t b = 0; b < series->num_blocks; ++b) {
+        fscl_data_stats_merge(stats, &series->blocks[b].stats);
+    }
+
+    if (stats->count == 0) {
+        stats->mean = NAN;
+        stats->variance = NAN;
+        stats->min = NAN;
+        stats->max = NAN;
+    }
+}
+
+// Function to decode one block
+size_t fscl_series_decode_block(const ctimeseries *series, size_t block, double *values) {
+    if (block >= series->num_blocks) {
+        return 0;
+    }
+    const ctimeseries_block *header = &series->blocks[block];
+    cseries_reader reader = {series->bits, header->offset};
+    fscl_series_decode(&reader, values, header->size, header->predictor);
+    return header->size;
+}
+
+// Function to sum the non-NaN values of [begin, end)
+double fscl_series_sum_range(const ctimeseries *series, size_t begin, size_t end) {
+    double values[FSCL_SERIES_BLOCK];
+    double sum = 0.0;
+
+    if (end > series->size) {
+        end = series->size;
+    }
+    while (begin < end) {
+        size_t b = begin / FSCL_SERIES_BLOCK;
+        size_t first = b * FSCL_SERIES_BLOCK;
+        size_t last = first + series->blocks[b].size;
+        size_t stop = end < last ? end : last;
+
+        if (begin == first && stop == last) {
+            sum += series->blocks[b].stats.sum;
+        } else {
+            fscl_series_decode_block(series, b, values);
+            for (size_t i = begin - first; i < stop - first; ++i) {
+                if (!isnan(values[i])) {
+                    sum += values[i];
+                }
+            }
+        }
+        begin = stop;
+    }
+    return sum;
+}
+
+// Function to stream the series one decoded block at a time
+int fscl_series_foreach(const ctimeseries *series, ctimeseries_callback callback, void *context) {
+    double values[FSCL_SERIES_BLOCK];
+    cdataset view = {values, 0, NULL};
+
+    for (size_t b = 0; b < series->num_blocks; ++b) {
+        view.size = fscl_series_decode_block(series, b, values);
+        if (callback(&view, b * FSCL_SERIES_BLOCK, context)) {
+            return 1;
+        }
+    }
+    return 0;
+}
+
+// Function to decompress a series into a new dataset
+int fscl_series_decompress(const ctimeseries *series, cdataset *dataset) {
+    fscl_data_create(dataset, series->size);
+    if (dataset->data == NULL && series->size > 0) {
+        return -1;
+    }
+    for (size_t b = 0; b < series->num_blocks; ++b) {
+        fscl_series_decode_block(series, b, dataset->data + b * FSCL_SERIES_BLOCK);
+    }
+    return 0;
+}
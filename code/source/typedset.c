@@ -0,0 +1,229 @@
+/*
+==============================================================================
+Author: Michael Gene Brockus (Dreamer)
+Email: michaelbrockus@gmail.com
+Organization: Fossil Logic
+Description: 
+    This file is part of the Fossil Logic project, where innovation meets
+    excellence in software development. Michael Gene Brockus, also known as
+    "Dreamer," is a dedicated contributor to this project. For any inquiries,
+    feel free to contact Michael at michaelbrockus@gmail.com.
+==============================================================================
+*/
+#include "fossil/xscience/typedset.h"
+#include "fossil/xscience/parallel.h"
+#include <string.h>
+
+// Elements per chunk; each chunk is summarized on its own and the partial
+// statistics are merged in chunk order, so results do not depend on the
+// number of threads
+#define FSCL_TYPED_CHUNK 16384
+
+// Missing-value tests: only floating-point elements can be NaN
+#define FSCL_TYPED_MISSING_REAL(x) isnan(x)
+#define FSCL_TYPED_MISSING_INT(x) ((void)(x), 0)
+
+// Conversions applied when scaling writes a double back to the element type
+#define FSCL_TYPED_NARROW_REAL(T, value, low, high) ((T)(value))
+#define FSCL_TYPED_NARROW_INT(T, value, low, high) ((T)fscl_typed_saturate(value, low, high))
+
+// Function to round to the nearest integer and clamp it to [low, high]
+static double fscl_typed_saturate(double value, double low, double high) {
+    if (isnan(value)) {
+        return 0.0;
+    }
+    value = nearbyint(value);
+    return value < low ? low : value > high ? high : value;
+}
+
+// Shared state of a chunked statistics or sum pass
+typedef struct {
+    const void *data;
+    cdataset_stats *partial;
+    double *sums;
+} cdataset_typed_job;
+
+// Template for one element type:
+//   S       suffix of the generated names
+//   T       element type
+//   ACC     accumulator of a chunk sum (exact for integers)
+//   MISSING missing-value test
+//   NARROW  conversion from double back to T
+//   LOW/HIGH range of T, used when narrowing integers
+#define FSCL_TYPED_DEFINE(S, T, ACC, MISSING, NARROW, LOW, HIGH)                    \
+                                                                                    \
+void fscl_data_create_##S(cdataset_##S *dataset, size_t size) {                     \
+    dataset->data = (T *)malloc(size * sizeof(T));                                  \
+    dataset->size = size;                                                           \
+}                                                                                   \
+                                                                                    \
+void fscl_data_erase_##S(cdataset_##S *dataset) {                                   \
+    free(dataset->data);                                                            \
+    dataset->data = NULL;                                                           \
+    dataset->size = 0;                                                              \
+}                                                                                   \
+                                                                                    \
+/* Two sweeps over a cache-resident chunk: count/sum/min/max, then the */         \
+/* squared deviations from the chunk mean */                                       \
+static void fscl_data_stats_range_##S(const T *data, size_t size, cdataset_stats *stats) { \
+    ACC sum = 0;                                                                    \
+    size_t count = 0;                                                               \
+    double min_val = INFINITY, max_val = -INFINITY;                                 \
+    for (size_t i = 0; i < size; ++i) {                                             \
+        T value = data[i];                                                          \
+        if (MISSING(value)) {                                                       \
+            continue;                                                               \
+        }                                                                           \
+        sum += value;                                                               \
+        ++count;                                                                    \
+        if (value < min_val) min_val = value;                                       \
+        if (value > max_val) max_val = value;                                       \
+    }                                                                               \
+                                                                                    \
+    memset(stats, 0, sizeof(*stats));                                               \
+    stats->nan_count = size - count;                                                \
+    if (count == 0) {                                                               \
+        return;                                                                     \
+    }                                                                               \
+    double mean = (double)sum / (double)count;                                      \
+    double m2 = 0.0;                                                                \
+    for (size_t i = 0; i < size; ++i) {                                             \
+        if (!MISSING(data[i])) {                                                    \
+            double delta = (double)data[i] - mean;                                  \
+            m2 += delta * delta;                                                    \
+        }                                                                           \
+    }                                                                               \
+    stats->count = count;                                                           \
+    stats->sum = (double)sum;                                                       \
+    stats->mean = mean;                                                             \
+    stats->variance = m2 / (double)count;                                           \
+    stats->min = min_val;                                                           \
+    stats->max = max_val;                                                           \
+}                                                                                   \
+                                                                                    \
+static void fscl_data_stats_chunk_##S(void *context, size_t begin, size_t end) {    \
+    cdataset_typed_job *job = (cdataset_typed_job *)context;                        \
+    fscl_data_stats_range_##S((const T *)job->data + begin, end - begin,            \
+                              &job->partial[begin / FSCL_TYPED_CHUNK]);             \
+}                                                                                   \
+                                                                                    \
+void fscl_data_stats_##S(const cdataset_##S *dataset, cdataset_stats *stats) {      \
+    size_t size = dataset->size;                                                    \
+    size_t chunks = (size + FSCL_TYPED_CHUNK - 1) / FSCL_TYPED_CHUNK;               \
+    cdataset_typed_job job = {dataset->data, NULL, NULL};                           \
+    cdataset_stats part;                                                            \
+                                                                                    \
+    memset(stats, 0, sizeof(*stats));                                               \
+    if (chunks > 1 && fscl_data_parallel(FSCL_DATA_EXEC_DEFAULT)) {                 \
+        job.partial = (cdataset_stats *)malloc(chunks * sizeof(cdataset_stats));    \
+    }                                                                               \
+    if (job.partial != NULL) {                                                      \
+        fscl_data_for(FSCL_DATA_EXEC_DEFAULT, size, FSCL_TYPED_CHUNK,               \
+                      fscl_data_stats_chunk_##S, &job);                             \
+        for (size_t c = 0; c < chunks; ++c) {                                       \
+            fscl_data_stats_merge(stats, &job.partial[c]);                          \
+        }                                                                           \
+        free(job.partial);                                                          \
+    } else {                                                                        \
+        for (size_t begin = 0; begin < size; begin += FSCL_TYPED_CHUNK) {           \
+            size_t end = size - begin > FSCL_TYPED_CHUNK ? begin + FSCL_TYPED_CHUNK : size; \
+            fscl_data_stats_range_##S(dataset->data + begin, end - begin, &part);   \
+            fscl_data_stats_merge(stats, &part);                                    \
+        }                                                                           \
+    }                                                                               \
+                                                                                    \
+    if (stats->count == 0) {                                                        \
+        stats->mean = NAN;                                                          \
+        stats->variance = NAN;                                                      \
+        stats->min = NAN;                                                           \
+        stats->max = NAN;                                                           \
+    }                                                                               \
+}                                                                                   \
+                                                                                    \
+/* Plain sum of a chunk; like the double sum, a NaN float makes it NaN */     \
+static double fscl_data_sum_range_##S(const T *data, size_t size) {                 \
+    ACC sum = 0;                                                                    \
+    for (size_t i = 0; i < size; ++i) {                                             \
+        sum += data[i];                                                             \
+    }                                                                               \
+    return (double)sum;                                                             \
+}                                                                                   \
+                                                                                    \
+static void fscl_data_sum_chunk_##S(void *context, size_t begin, size_t end) {      \
+    cdataset_typed_job *job = (cdataset_typed_job *)context;                        \
+    job->sums[begin / FSCL_TYPED_CHUNK] =                                           \
+        fscl_data_sum_range_##S((const T *)job->data + begin, end - begin);         \
+}                                                                                   \
+                                                                                    \
+double fscl_data_sum_##S(const cdataset_##S *dataset) {                             \
+    size_t size = dataset->size;                                                    \
+    size_t chunks = (size + FSCL_TYPED_CHUNK - 1) / FSCL_TYPED_CHUNK;               \
+    cdataset_typed_job job = {dataset->data, NULL, NULL};                           \
+    double sum = 0.0;                                                               \
+                                                                                    \
+    if (chunks > 1 && fscl_data_parallel(FSCL_DATA_EXEC_DEFAULT)) {                 \
+        job.sums = (double *)malloc(chunks * sizeof(double));                       \
+    }                                                                               \
+    if (job.sums != NULL) {                                                         \
+        fscl_data_for(FSCL_DATA_EXEC_DEFAULT, size, FSCL_TYPED_CHUNK,               \
+                      fscl_data_sum_chunk_##S, &job);                               \
+        for (size_t c = 0; c < chunks; ++c) {                                       \
+            sum += job.sums[c];                                                     \
+        }                                                                           \
+        free(job.sums);                                                             \
+    } else {                                                                        \
+        for (size_t begin = 0; begin < size; begin += FSCL_TYPED_CHUNK) {           \
+            size_t end = size - begin > FSCL_TYPED_CHUNK ? begin + FSCL_TYPED_CHUNK : size; \
+            sum += fscl_data_sum_range_##S(dataset->data + begin, end - begin);     \
+        }                                                                           \
+    }                                                                               \
+    return sum;                                                                     \
+}                                                                                   \
+                                                                                    \
+double fscl_data_mean_##S(const cdataset_##S *dataset) {                            \
+    return fscl_data_sum_##S(dataset) / (double)dataset->size;                      \
+}                                                                                   \
+                                                                                    \
+double fscl_data_min_##S(const cdataset_##S *dataset) {                             \
+    cdataset_stats stats;                                                           \
+    fscl_data_stats_##S(dataset, &stats);                                           \
+    return stats.min;                                                               \
+}                                                                                   \
+                                                                                    \
+double fscl_data_max_##S(const cdataset_##S *dataset) {                             \
+    cdataset_stats stats;                                                           \
+    fscl_data_stats_##S(dataset, &stats);                                           \
+    return stats.max;                                                               \
+}                                                                                   \
+                                                                                    \
+double fscl_data_std_dev_##S(const cdataset_##S *dataset) {                         \
+    cdataset_stats stats;                                                           \
+    fscl_data_stats_##S(dataset, &stats);                                           \
+    if (stats.nan_count > 0) {                                                      \
+        return NAN;                                                                 \
+    }                                                                               \
+    return sqrt(stats.variance);                                                    \
+}                                                                                   \
+                                                                                    \
+void fscl_data_scale_##S(cdataset_##S *dataset, double factor) {                    \
+    for (size_t i = 0; i < dataset->size; ++i) {                                    \
+        double value = (double)dataset->data[i] * factor;                           \
+        dataset->data[i] = NARROW(T, value, LOW, HIGH);                             \
+    }                                                                               \
+}                                                                                   \
+                                                                                    \
+int fscl_data_to_double_##S(const cdataset_##S *dataset, cdataset *result) {        \
+    fscl_data_create(result, dataset->size);                                        \
+    if (result->data == NULL && dataset->size > 0) {                                \
+        fprintf(stderr, "Error: Memory allocation failed for dataset.\n");          \
+        return -1;                                                                  \
+    }                                                                               \
+    for (size_t i = 0; i < dataset->size; ++i) {                                    \
+        result->data[i] = (double)dataset->data[i];                                 \
+    }                                                                               \
+    return 0;                                                                       \
+}
+
+FSCL_TYPED_DEFINE(f32, float, double, FSCL_TYPED_MISSING_REAL, FSCL_TYPED_NARROW_REAL, 0, 0)
+FSCL_TYPED_DEFINE(i32, int32_t, int64_t, FSCL_TYPED_MISSING_INT, FSCL_TYPED_NARROW_INT, INT32_MIN, INT32_MAX)
+FSCL_TYPED_DEFINE(i16, int16_t, int64_t, FSCL_TYPED_MISSING_INT, FSCL_TYPED_NARROW_INT, INT16_MIN, INT16_MAX)
@@ -0,0 +1,150 @@
+/*
+==============================================================================
+Author: Michael Gene Brockus (Dreamer)
+Email: michaelbrockus@gmail.com
+Organization: Fossil Logic
+Description: 
+    This file is part of the Fossil Logic project, where innovation meets
+    excellence in software development. Michael Gene Brockus, also known as
+    "Dreamer," is a dedicated contributor to this project. For any inquiries,
+    feel free to contact Michael at michaelbrockus@gmail.com.
+==============================================================================
+*/
+#include <fossil/xtest.h>   // basic test tools
+#include <fossil/xassert.h> // extra asserts
+
+#include <fossil/xscience/accumulator.h> // library under test
+#include <fossil/xscience/parallel.h>
+
+//
+// XUNIT-CASES: list of test cases testing project features
+//
+
+XTEST_CASE(test_fscl_accum_update) {
+    caccumulator accum;
+    fscl_accum_init(&accum);
+
+    double values[] = {2.0, 4.0, 4.0, NAN, 4.0, 5.0, 5.0, 7.0, 9.0};
+    for (size_t i = 0; i < 9; ++i) {
+        fscl_accum_update(&accum, values[i]);
+    }
+
+    cdataset_stats stats;
+    fscl_accum_stats(&accum, &stats);
+    TEST_ASSERT_EQUAL_UINT(8, stats.count);
+    TEST_ASSERT_EQUAL_UINT(1, stats.nan_count);
+    TEST_ASSERT_DOUBLE_EQUAL(5.0, stats.mean);
+    TEST_ASSERT_DOUBLE_EQUAL(4.0, stats.variance);
+    TEST_ASSERT_DOUBLE_EQUAL(2.0, stats.min);
+    TEST_ASSERT_DOUBLE_EQUAL(9.0, stats.max);
+}
+
+XTEST_CASE(test_fscl_accum_merge_shards) {
+    cdataset whole;
+    fscl_data_create(&whole, 3000);
+    for (size_t i = 0; i < whole.size; ++i) {
+        whole.data[i] = (double)((i * 53) % 1000) * 0.5;
+    }
+
+    // Three shards accumulated separately, then merged
+    caccumulator total, shard;
+    fscl_accum_init(&total);
+    for (size_t s = 0; s < 3; ++s) {
+        cdataset view = {whole.data + s * 1000, 1000, NULL};
+        fscl_accum_init(&shard);
+        fscl_accum_update_data(&shard, &view);
+        fscl_accum_merge(&total, &shard);
+    }
+
+    cdataset_stats merged, direct;
+    fscl_accum_stats(&total, &merged);
+    fscl_data_stats(&whole, &direct);
+    TEST_ASSERT_EQUAL_UINT(direct.count, merged.count);
+    TEST_ASSERT_DOUBLE_EQUAL(direct.mean, merged.mean);
+    TEST_ASSERT_DOUBLE_EQUAL(direct.variance, merged.variance);
+    TEST_ASSERT_DOUBLE_EQUAL(direct.max, merged.max);
+
+    fscl_data_erase(&whole);
+}
+
+XTEST_CASE(test_fscl_data_stats_merge_matches_accum) {
+    double left[] = {1.0, 2.5, NAN, 8.0};
+    double right[] = {-4.0, 3.0, 3.0};
+    cdataset a = {left, 4, NULL}, b = {right, 3, NULL};
+
+    cdataset_stats merged, part;
+    fscl_data_stats(&a, &merged);
+    fscl_data_stats(&b, &part);
+    fscl_data_stats_merge(&merged, &part);
+
+    caccumulator accum;
+    fscl_accum_init(&accum);
+    fscl_accum_update_data(&accum, &a);
+    fscl_accum_update_data(&accum, &b);
+    cdataset_stats expected;
+    fscl_accum_stats(&accum, &expected);
+
+    TEST_ASSERT_EQUAL_UINT(6, merged.count);
+    TEST_ASSERT_EQUAL_UINT(1, merged.nan_count);
+    TEST_ASSERT_TRUE(merged.mean == expected.mean);
+    TEST_ASSERT_TRUE(merged.variance == expected.variance);
+    TEST_ASSERT_DOUBLE_EQUAL(-4.0, merged.min);
+
+    // Merging nothing but NaN keeps the statistics and counts the NaN
+    double missing[] = {NAN};
+    cdataset c = {missing, 1, NULL};
+    fscl_data_stats(&c, &part);
+    fscl_data_stats_merge(&merged, &part);
+    TEST_ASSERT_EQUAL_UINT(2, merged.nan_count);
+    TEST_ASSERT_TRUE(merged.mean == expected.mean);
+}
+
+XTEST_CASE(test_fscl_accum_serialize) {
+    caccumulator accum, copy;
+    fscl_accum_init(&accum);
+    fscl_accum_update(&accum, 1.5);
+    fscl_accum_update(&accum, -3.0);
+
+    unsigned char buffer[FSCL_ACCUM_SERIALIZED_SIZE];
+    fscl_accum_serialize(&accum, buffer);
+    TEST_ASSERT_EQUAL_INT(0, fscl_accum_deserialize(&copy, buffer));
+    TEST_ASSERT_EQUAL_UINT(2, copy.count);
+    TEST_ASSERT_DOUBLE_EQUAL(accum.m2, copy.m2);
+    TEST_ASSERT_DOUBLE_EQUAL(-3.0, copy.min);
+
+    buffer[0] ^= 0xFF;
+    TEST_ASSERT_EQUAL_INT(-1, fscl_accum_deserialize(&copy, buffer));
+}
+
+XTEST_CASE(test_fscl_data_stats_thread_independent) {
+    cdataset myDataset;
+    fscl_data_create(&myDataset, 200001);
+    for (size_t i = 0; i < myDataset.size; ++i) {
+        myDataset.data[i] = (double)((i * 7919) % 10007) * 0.001;
+    }
+
+    cdataset_stats serial, parallel;
+    fscl_data_stats(&myDataset, &serial);
+    double serial_sum = fscl_data_sum(&myDataset);
+    fscl_parallel_set_threads(4);
+    fscl_data_stats(&myDataset, &parallel);
+    double parallel_sum = fscl_data_sum(&myDataset);
+    fscl_parallel_set_threads(1);
+
+    TEST_ASSERT_TRUE(serial.mean == parallel.mean);
+    TEST_ASSERT_TRUE(serial.variance == parallel.variance);
+    TEST_ASSERT_TRUE(serial_sum == parallel_sum);
+
+    fscl_data_erase(&myDataset);
+}
+
+//
+// XUNIT-GROUP: a group of test cases from the current test file
+//
+XTEST_DEFINE_POOL(test_accumulator_group) {
+    XTEST_RUN_UNIT(test_fscl_accum_update);
+    XTEST_RUN_UNIT(test_fscl_accum_merge_shards);
+    XTEST_RUN_UNIT(test_fscl_data_stats_merge_matches_accum);
+    XTEST_RUN_UNIT(test_fscl_accum_serialize);
+    XTEST_RUN_UNIT(test_fscl_data_stats_thread_independent);
+} // end of fixture
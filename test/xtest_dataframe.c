@@ -0,0 +1,113 @@
+/*
+==============================================================================
+Author: Michael Gene Brockus (Dreamer)
+Email: michaelbrockus@gmail.com
+Organization: Fossil Logic
+Description: 
+    This file is part of the Fossil Logic project, where innovation meets
+    excellence in software development. Michael Gene Brockus, also known as
+    "Dreamer," is a dedicated contributor to this project. For any inquiries,
+    feel free to contact Michael at michaelbrockus@gmail.com.
+==============================================================================
+*/
+#include <fossil/xtest.h>   // basic test tools
+#include <fossil/xassert.h> // extra asserts
+
+#include <fossil/xscience/dataframe.h> // library under test
+#include <stdint.h>
+
+//
+// XUNIT-CASES: list of test cases testing project features
+//
+
+XTEST_CASE(test_fscl_dataframe_columns) {
+    cdataframe frame;
+    fscl_dataframe_create(&frame, 4);
+
+    cdataset *height = fscl_dataframe_add_column(&frame, "height");
+    cdataset *weight = fscl_dataframe_add_column(&frame, "weight");
+    TEST_ASSERT_NOT_CNULLPTR(height);
+    TEST_ASSERT_NOT_CNULLPTR(weight);
+    TEST_ASSERT_CNULLPTR(fscl_dataframe_add_column(&frame, "height"));
+    TEST_ASSERT_EQUAL_UINT(0, (uintptr_t)fscl_dataframe_column(&frame, "weight")->data % 64);
+    TEST_ASSERT_EQUAL_UINT(4, fscl_dataframe_column(&frame, "height")->size);
+    TEST_ASSERT_CNULLPTR(fscl_dataframe_column(&frame, "age"));
+
+    fscl_dataframe_erase(&frame);
+    TEST_ASSERT_EQUAL_UINT(0, frame.num_columns);
+}
+
+XTEST_CASE(test_fscl_dataframe_preprocess) {
+    cdataframe frame;
+    fscl_dataframe_create(&frame, 4);
+
+    cdataset *value = fscl_dataframe_add_column(&frame, "value");
+    double values[] = {2.0, NAN, 6.0, 10.0};
+    for (size_t i = 0; i < 4; ++i) {
+        value->data[i] = values[i];
+    }
+
+    fscl_dataframe_replace_missing(&frame, "value", 4.0);
+    fscl_dataframe_normalize(&frame, NULL);
+    value = fscl_dataframe_column(&frame, "value");
+    TEST_ASSERT_DOUBLE_EQUAL(0.0, value->data[0]);
+    TEST_ASSERT_DOUBLE_EQUAL(0.25, value->data[1]);
+    TEST_ASSERT_DOUBLE_EQUAL(1.0, value->data[3]);
+
+    fscl_dataframe_erase(&frame);
+}
+
+XTEST_CASE(test_fscl_dataframe_one_hot_encode) {
+    cdataframe frame;
+    fscl_dataframe_create(&frame, 3);
+
+    cdataset *color = fscl_dataframe_add_column(&frame, "color");
+    color->data[0] = 2.0;
+    color->data[1] = 0.0;
+    color->data[2] = 2.0;
+
+    TEST_ASSERT_EQUAL_UINT(3, fscl_dataframe_one_hot_encode(&frame, "color"));
+    TEST_ASSERT_EQUAL_UINT(4, frame.num_columns);
+    TEST_ASSERT_DOUBLE_EQUAL(1.0, fscl_dataframe_column(&frame, "color=2")->data[0]);
+    TEST_ASSERT_DOUBLE_EQUAL(1.0, fscl_dataframe_column(&frame, "color=0")->data[1]);
+    TEST_ASSERT_DOUBLE_EQUAL(0.0, fscl_dataframe_column(&frame, "color=1")->data[2]);
+
+    fscl_dataframe_erase(&frame);
+}
+
+XTEST_CASE(test_fscl_dataframe_one_hot_encode_rejects) {
+    cdataframe frame;
+    fscl_dataframe_create(&frame, 3);
+
+    cdataset *color = fscl_dataframe_add_column(&frame, "color");
+    color->data[0] = 1.0;
+    color->data[1] = 2.5;
+    color->data[2] = 0.0;
+    TEST_ASSERT_EQUAL_UINT(0, fscl_dataframe_one_hot_encode(&frame, "color"));
+    TEST_ASSERT_EQUAL_UINT(1, frame.num_columns);
+
+    color->data[1] = INFINITY;
+    TEST_ASSERT_EQUAL_UINT(0, fscl_dataframe_one_hot_encode(&frame, "color"));
+    color->data[1] = 1e12;
+    TEST_ASSERT_EQUAL_UINT(0, fscl_dataframe_one_hot_encode(&frame, "color"));
+    TEST_ASSERT_EQUAL_UINT(1, frame.num_columns);
+
+    // A clash on "color=2" fails half way; the columns added are removed
+    color->data[1] = 3.0;
+    fscl_dataframe_add_column(&frame, "color=2");
+    TEST_ASSERT_EQUAL_UINT(0, fscl_dataframe_one_hot_encode(&frame, "color"));
+    TEST_ASSERT_EQUAL_UINT(2, frame.num_columns);
+    TEST_ASSERT_CNULLPTR(fscl_dataframe_column(&frame, "color=0"));
+
+    fscl_dataframe_erase(&frame);
+}
+
+//
+// XUNIT-GROUP: a group of test cases from the current test file
+//
+XTEST_DEFINE_POOL(test_dataframe_group) {
+    XTEST_RUN_UNIT(test_fscl_dataframe_columns);
+    XTEST_RUN_UNIT(test_fscl_dataframe_preprocess);
+    XTEST_RUN_UNIT(test_fscl_dataframe_one_hot_encode);
+    XTEST_RUN_UNIT(test_fscl_dataframe_one_hot_encode_rejects);
+} // end of fixture
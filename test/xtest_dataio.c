@@ -0,0 +1,277 @@
+/*
+==============================================================================
+Author: Michael Gene Brockus (Dreamer)
+Email: michaelbrockus@gmail.com
+Organization: Fossil Logic
+Description: 
+    This file is part of the Fossil Logic project, where innovation meets
+    excellence in software development. Michael Gene Brockus, also known as
+    "Dreamer," is a dedicated contributor to this project. For any inquiries,
+    feel free to contact Michael at michaelbrockus@gmail.com.
+==============================================================================
+*/
+#include <fossil/xtest.h>   // basic test tools
+#include <fossil/xassert.h> // extra asserts
+
+#include <fossil/xscience/dataio.h> // library under test
+#include <stdint.h>
+#include <string.h>
+
+//
+// XUNIT-CASES: list of test cases testing project features
+//
+
+// Writes 0, 1, ..., count - 1 as raw doubles
+static void write_raw_doubles(const char *path, size_t count) {
+    FILE *file = fopen(path, "wb");
+    for (size_t i = 0; i < count; ++i) {
+        double value = (double)i;
+        fwrite(&value, sizeof(double), 1, file);
+    }
+    fclose(file);
+}
+
+XTEST_CASE(test_fscl_data_mmap_readonly) {
+    const char *path = "xtest_dataio_mmap.bin";
+    write_raw_doubles(path, 1000);
+
+    cdataset myDataset;
+    TEST_ASSERT_EQUAL_INT(0, fscl_data_open_mmap(&myDataset, path, FSCL_DATA_MAP_READONLY));
+    TEST_ASSERT_EQUAL_UINT(1000, myDataset.size);
+    TEST_ASSERT_DOUBLE_EQUAL(499500.0, fscl_data_sum(&myDataset));
+    TEST_ASSERT_DOUBLE_EQUAL(999.0, fscl_data_max(&myDataset));
+
+    fscl_data_close_mmap(&myDataset);
+    TEST_ASSERT_CNULLPTR(myDataset.data);
+    TEST_ASSERT_EQUAL_UINT(0, myDataset.size);
+    remove(path);
+}
+
+XTEST_CASE(test_fscl_data_mmap_private) {
+    const char *path = "xtest_dataio_cow.bin";
+    write_raw_doubles(path, 10);
+
+    cdataset myDataset;
+    TEST_ASSERT_EQUAL_INT(0, fscl_data_open_mmap(&myDataset, path, FSCL_DATA_MAP_PRIVATE));
+    fscl_data_scale(&myDataset, 2.0);
+    TEST_ASSERT_DOUBLE_EQUAL(18.0, myDataset.data[9]);
+    fscl_data_erase(&myDataset);
+
+    // Copy-on-write pages never reach the file
+    TEST_ASSERT_EQUAL_INT(0, fscl_data_open_mmap(&myDataset, path, FSCL_DATA_MAP_READONLY));
+    TEST_ASSERT_DOUBLE_EQUAL(9.0, myDataset.data[9]);
+    fscl_data_close_mmap(&myDataset);
+    remove(path);
+}
+
+XTEST_CASE(test_fscl_data_mmap_missing_file) {
+    cdataset myDataset;
+    TEST_ASSERT_EQUAL_INT(-1, fscl_data_open_mmap(&myDataset, "xtest_dataio_missing.bin", FSCL_DATA_MAP_READONLY));
+    TEST_ASSERT_CNULLPTR(myDataset.data);
+}
+
+XTEST_CASE(test_fscl_data_save_and_load) {
+    const char *path = "xtest_dataio_saved.fsd";
+    cdataset myDataset;
+    fscl_data_create(&myDataset, 150000);  // three table blocks
+    for (size_t i = 0; i < myDataset.size; ++i) {
+        myDataset.data[i] = (double)i;
+    }
+    myDataset.data[3] = NAN;
+    TEST_ASSERT_EQUAL_INT(0, fscl_data_save(&myDataset, path, FSCL_DATA_FILE_CHECKSUMS | FSCL_DATA_FILE_STATS));
+
+    cdataset loaded;
+    TEST_ASSERT_EQUAL_INT(0, fscl_data_load(&loaded, path));
+    TEST_ASSERT_EQUAL_UINT(myDataset.size, loaded.size);
+    TEST_ASSERT_TRUE(((uintptr_t)loaded.data & 63) == 0);
+    TEST_ASSERT_DOUBLE_EQUAL(149999.0, loaded.data[149999]);
+    TEST_ASSERT_TRUE(isnan(loaded.data[3]));
+    fscl_data_erase(&loaded);
+
+    // Zero-copy view of the same elements, 64 bytes into the file
+    TEST_ASSERT_EQUAL_INT(0, fscl_data_load_mmap(&loaded, path, FSCL_DATA_MAP_READONLY));
+    TEST_ASSERT_EQUAL_UINT(myDataset.size, loaded.size);
+    TEST_ASSERT_TRUE(memcmp(myDataset.data, loaded.data, myDataset.size * sizeof(double)) == 0);
+    fscl_data_erase(&loaded);
+
+    cdataset_stats stats;
+    TEST_ASSERT_EQUAL_INT(0, fscl_data_file_stats(path, &stats));
+    TEST_ASSERT_EQUAL_UINT(149999, stats.count);
+    TEST_ASSERT_EQUAL_UINT(1, stats.nan_count);
+    TEST_ASSERT_DOUBLE_EQUAL(149999.0, stats.max);
+
+    // A flipped byte in the elements fails the checksum
+    FILE *file = fopen(path, "r+b");
+    fseek(file, 64 + 8 * 100000 + 2, SEEK_SET);
+    fputc(0x5A, file);
+    fclose(file);
+    TEST_ASSERT_EQUAL_INT(-1, fscl_data_load(&loaded, path));
+    TEST_ASSERT_CNULLPTR(loaded.data);
+
+    fscl_data_erase(&myDataset);
+    remove(path);
+}
+
+// Bitwise CRC32C, to forge a header that passes its checksum
+static uint32_t header_crc(const unsigned char *bytes, size_t length) {
+    uint32_t crc = 0xFFFFFFFFu;
+    for (size_t i = 0; i < length; ++i) {
+        crc ^= bytes[i];
+        for (int bit = 0; bit < 8; ++bit) {
+            crc = (crc >> 1) ^ (0x82F63B78u & (0u - (crc & 1u)));
+        }
+    }
+    return ~crc;
+}
+
+XTEST_CASE(test_fscl_data_file_stats_without_table) {
+    const char *path = "xtest_dataio_notable.fsd";
+    cdataset myDataset;
+    fscl_data_create(&myDataset, 100);
+    for (size_t i = 0; i < myDataset.size; ++i) {
+        myDataset.data[i] = (double)i;
+    }
+    TEST_ASSERT_EQUAL_INT(0, fscl_data_save(&myDataset, path, 0));
+
+    // Claim a statistics table, with a zero block size and then a valid
+    // one, while table_offset stays 0; the header checksum is kept valid
+    uint32_t block_sizes[] = {0, 65536};
+    for (size_t t = 0; t < 2; ++t) {
+        unsigned char header[64];
+        FILE *file = fopen(path, "r+b");
+        TEST_ASSERT_TRUE(fread(header, 1, sizeof(header), file) == sizeof(header));
+        uint32_t flags = FSCL_DATA_FILE_STATS;
+        memcpy(header + 16, &flags, sizeof(flags));
+        memcpy(header + 20, &block_sizes[t], sizeof(uint32_t));
+        uint32_t crc = header_crc(header, 52);
+        memcpy(header + 52, &crc, sizeof(crc));
+        fseek(file, 0, SEEK_SET);
+        fwrite(header, 1, sizeof(header), file);
+        fclose(file);
+
+        cdataset_stats stats;
+        cdataset loaded;
+        TEST_ASSERT_EQUAL_INT(-1, fscl_data_file_stats(path, &stats));
+        TEST_ASSERT_EQUAL_INT(-1, fscl_data_load(&loaded, path));
+    }
+
+    // An empty dataset has no blocks, so its flags need no table
+    cdataset empty = {NULL, 0, NULL};
+    cdataset_stats stats;
+    TEST_ASSERT_EQUAL_INT(0, fscl_data_save(&empty, path, FSCL_DATA_FILE_STATS));
+    TEST_ASSERT_EQUAL_INT(0, fscl_data_file_stats(path, &stats));
+    TEST_ASSERT_EQUAL_UINT(0, stats.count);
+
+    fscl_data_erase(&myDataset);
+    remove(path);
+}
+
+XTEST_CASE(test_fscl_data_load_rejects_raw_file) {
+    const char *path = "xtest_dataio_raw.bin";
+    write_raw_doubles(path, 100);
+
+    cdataset myDataset;
+    TEST_ASSERT_EQUAL_INT(-1, fscl_data_load(&myDataset, path));
+    TEST_ASSERT_EQUAL_INT(-1, fscl_data_load_mmap(&myDataset, path, FSCL_DATA_MAP_READONLY));
+    TEST_ASSERT_CNULLPTR(myDataset.data);
+    remove(path);
+}
+
+// Folds every chunk of the first column into running statistics
+static int accumulate_first_column(const cdataset *columns, size_t num_columns, void *context) {
+    cdataset_stats part;
+    (void)num_columns;
+    fscl_data_stats(&columns[0], &part);
+    fscl_data_stats_merge((cdataset_stats *)context, &part);
+    return 0;
+}
+
+XTEST_CASE(test_fscl_data_csv_chunks) {
+    const char *path = "xtest_dataio_chunks.csv";
+    FILE *file = fopen(path, "wb");
+    fprintf(file, "id,value,label\r\n");
+    fprintf(file, "1, 2.5 ,\"7\"\r\n");
+    fprintf(file, "2,,1e3\n");
+    fprintf(file, "\n");
+    fprintf(file, "3,-0.125\n");
+    fprintf(file, "4,abc,5,99");
+    fclose(file);
+
+    cdataset_csv reader;
+    TEST_ASSERT_EQUAL_INT(0, fscl_data_csv_open(&reader, path, ',', 1, 3));
+    TEST_ASSERT_EQUAL_UINT(3, reader.columns);
+
+    TEST_ASSERT_EQUAL_UINT(3, fscl_data_csv_next(&reader));
+    cdataset value = fscl_data_csv_column(&reader, 1);
+    cdataset label = fscl_data_csv_column(&reader, 2);
+    TEST_ASSERT_DOUBLE_EQUAL(2.5, value.data[0]);
+    TEST_ASSERT_TRUE(isnan(value.data[1]));
+    TEST_ASSERT_DOUBLE_EQUAL(-0.125, value.data[2]);
+    TEST_ASSERT_DOUBLE_EQUAL(7.0, label.data[0]);
+    TEST_ASSERT_DOUBLE_EQUAL(1000.0, label.data[1]);
+    TEST_ASSERT_TRUE(isnan(label.data[2])); // short row
+
+    TEST_ASSERT_EQUAL_UINT(1, fscl_data_csv_next(&reader));
+    value = fscl_data_csv_column(&reader, 1);
+    TEST_ASSERT_TRUE(isnan(value.data[0]));
+    TEST_ASSERT_EQUAL_UINT(0, fscl_data_csv_next(&reader));
+
+    fscl_data_csv_close(&reader);
+    remove(path);
+}
+
+XTEST_CASE(test_fscl_data_csv_long_tokens) {
+    // Fields of 64 characters and more still parse: a long decimal
+    // expansion, and a value padded with leading zeros
+    const char *path = "xtest_dataio_long.csv";
+    FILE *file = fopen(path, "wb");
+    fprintf(file, "3.14159265358979323846264338327950288419716939937510582097494459230781640628620899,");
+    fprintf(file, "%080d12.5,", 0);
+    fprintf(file, "-%070d0.12345678901234567\n", 0);
+    fclose(file);
+
+    cdataset_csv reader;
+    TEST_ASSERT_EQUAL_INT(0, fscl_data_csv_open(&reader, path, ',', 0, 4));
+    TEST_ASSERT_EQUAL_UINT(1, fscl_data_csv_next(&reader));
+    TEST_ASSERT_TRUE(fscl_data_csv_column(&reader, 0).data[0] == 3.141592653589793);
+    TEST_ASSERT_TRUE(fscl_data_csv_column(&reader, 1).data[0] == 12.5);
+    TEST_ASSERT_TRUE(fscl_data_csv_column(&reader, 2).data[0] == -0.12345678901234567);
+
+    fscl_data_csv_close(&reader);
+    remove(path);
+}
+
+XTEST_CASE(test_fscl_data_csv_foreach_stats) {
+    const char *path = "xtest_dataio_stream.csv";
+    FILE *file = fopen(path, "wb");
+    for (int i = 0; i < 20000; ++i) {
+        fprintf(file, "%d.25\t%d\n", i, i % 7);
+    }
+    fclose(file);
+
+    cdataset_stats stats = {0};
+    TEST_ASSERT_EQUAL_INT(0, fscl_data_csv_foreach(path, '\t', 0, 4096, accumulate_first_column, &stats));
+
+    // 0.25, 1.25, ..., 19999.25
+    TEST_ASSERT_EQUAL_UINT(20000, stats.count);
+    TEST_ASSERT_DOUBLE_EQUAL(9999.75, stats.mean);
+    TEST_ASSERT_DOUBLE_EQUAL(0.25, stats.min);
+    TEST_ASSERT_DOUBLE_EQUAL(19999.25, stats.max);
+    TEST_ASSERT_DOUBLE_EQUAL((20000.0 * 20000.0 - 1.0) / 12.0, stats.variance);
+    remove(path);
+}
+
+//
+// XUNIT-GROUP: a group of test cases from the current test file
+//
+XTEST_DEFINE_POOL(test_dataio_group) {
+    XTEST_RUN_UNIT(test_fscl_data_mmap_readonly);
+    XTEST_RUN_UNIT(test_fscl_data_mmap_private);
+    XTEST_RUN_UNIT(test_fscl_data_mmap_missing_file);
+    XTEST_RUN_UNIT(test_fscl_data_save_and_load);
+    XTEST_RUN_UNIT(test_fscl_data_file_stats_without_table);
+    XTEST_RUN_UNIT(test_fscl_data_load_rejects_raw_file);
+    XTEST_RUN_UNIT(test_fscl_data_csv_chunks);
+    XTEST_RUN_UNIT(test_fscl_data_csv_long_tokens);
+    XTEST_RUN_UNIT(test_fscl_data_csv_foreach_stats);
+} // end of fixture
@@ -14,6 +14,9 @@ Description:
 #include <fossil/xassert.h> // extra asserts
 
 #include <fossil/xscience/dataset.h> // library under test
+#include <fossil/xscience/parallel.h>
+#include <string.h>
+#include <time.h>
 
 //
 // XUNIT-CASES: list of test cases testing project features
@@ -110,6 +113,459 @@ XTEST_CASE(test_fscl_data_multiply) {
     fscl_data_erase(&result);
 }
 
+XTEST_CASE(test_fscl_data_reductions) {
+    cdataset dataset1, dataset2;
+    fscl_data_create(&dataset1, 77); // odd size exercises every kernel tail
+    fscl_data_create(&dataset2, 77);
+
+    for (size_t i = 0; i < dataset1.size; ++i) {
+        dataset1.data[i] = (double)((i * 37) % 77) - 20.0;
+        dataset2.data[i] = 2.0;
+    }
+
+    // values are a permutation of -20..56
+    TEST_ASSERT_DOUBLE_EQUAL(1386.0, fscl_data_sum(&dataset1));
+    TEST_ASSERT_DOUBLE_EQUAL(18.0, fscl_data_mean(&dataset1));
+    TEST_ASSERT_DOUBLE_EQUAL(-20.0, fscl_data_min(&dataset1));
+    TEST_ASSERT_DOUBLE_EQUAL(56.0, fscl_data_max(&dataset1));
+    TEST_ASSERT_DOUBLE_EQUAL(2772.0, fscl_data_dot_product(&dataset1, &dataset2));
+
+    // NaN elements are skipped by min/max like the scalar loop did
+    dataset1.data[40] = NAN;
+    TEST_ASSERT_DOUBLE_EQUAL(-20.0, fscl_data_min(&dataset1));
+    TEST_ASSERT_DOUBLE_EQUAL(56.0, fscl_data_max(&dataset1));
+    TEST_ASSERT_TRUE(fscl_data_simd_level() >= FSCL_DATA_SIMD_SCALAR);
+
+    fscl_data_erase(&dataset1);
+    fscl_data_erase(&dataset2);
+}
+
+XTEST_CASE(test_fscl_data_stats) {
+    cdataset myDataset;
+    fscl_data_create(&myDataset, 1001); // spans several stats blocks
+
+    for (size_t i = 0; i < myDataset.size; ++i) {
+        myDataset.data[i] = (double)i;
+    }
+    myDataset.data[1000] = NAN;
+
+    cdataset_stats stats;
+    fscl_data_stats(&myDataset, &stats);
+
+    // 0..999: mean 499.5, population variance (n^2 - 1) / 12
+    TEST_ASSERT_EQUAL_UINT(1000, stats.count);
+    TEST_ASSERT_EQUAL_UINT(1, stats.nan_count);
+    TEST_ASSERT_DOUBLE_EQUAL(499500.0, stats.sum);
+    TEST_ASSERT_DOUBLE_EQUAL(499.5, stats.mean);
+    TEST_ASSERT_DOUBLE_EQUAL(83333.25, stats.variance);
+    TEST_ASSERT_DOUBLE_EQUAL(0.0, stats.min);
+    TEST_ASSERT_DOUBLE_EQUAL(999.0, stats.max);
+    TEST_ASSERT_TRUE(isnan(fscl_data_std_dev(&myDataset)));
+
+    fscl_data_erase(&myDataset);
+}
+
+XTEST_CASE(test_fscl_data_standardize_and_outliers) {
+    cdataset myDataset;
+    fscl_data_create(&myDataset, 6);
+
+    double values[] = {2.0, 4.0, 4.0, 4.0, 5.0, 5.0};
+    for (size_t i = 0; i < myDataset.size; ++i) {
+        myDataset.data[i] = values[i];
+    }
+    TEST_ASSERT_DOUBLE_EQUAL(1.0, fscl_data_std_dev(&myDataset));
+
+    fscl_data_standardize(&myDataset);
+    TEST_ASSERT_DOUBLE_EQUAL(-2.0, myDataset.data[0]);
+    TEST_ASSERT_DOUBLE_EQUAL(1.0, myDataset.data[5]);
+
+    myDataset.data[3] = NAN;
+    fscl_data_remove_outliers(&myDataset, 1.5);
+    TEST_ASSERT_EQUAL_UINT(4, myDataset.size);
+
+    fscl_data_erase(&myDataset);
+}
+
+XTEST_CASE(test_fscl_data_remove_missing) {
+    cdataset myDataset;
+    fscl_data_create(&myDataset, 1003);
+    size_t kept = 0;
+    for (size_t i = 0; i < myDataset.size; ++i) {
+        myDataset.data[i] = (i % 3 == 1 || i % 7 == 0) ? NAN : (double)i;
+        kept += isnan(myDataset.data[i]) ? 0 : 1;
+    }
+
+    fscl_data_remove_missing(&myDataset);
+    TEST_ASSERT_EQUAL_UINT(kept, myDataset.size);
+
+    // Survivors keep their original order
+    int ordered = 1;
+    for (size_t i = 0; i < myDataset.size; ++i) {
+        if (isnan(myDataset.data[i]) || (i > 0 && myDataset.data[i] <= myDataset.data[i - 1])) {
+            ordered = 0;
+        }
+    }
+    TEST_ASSERT_TRUE(ordered);
+
+    fscl_data_erase(&myDataset);
+}
+
+XTEST_CASE(test_fscl_data_normalize_features) {
+    cdataset myDataset;
+    fscl_data_create(&myDataset, 5);
+
+    double values[] = {10.0, 20.0, NAN, 30.0, 50.0};
+    for (size_t i = 0; i < myDataset.size; ++i) {
+        myDataset.data[i] = values[i];
+    }
+
+    fscl_data_normalize_features(&myDataset);
+    TEST_ASSERT_DOUBLE_EQUAL(0.0, myDataset.data[0]);
+    TEST_ASSERT_DOUBLE_EQUAL(0.25, myDataset.data[1]);
+    TEST_ASSERT_TRUE(isnan(myDataset.data[2]));
+    TEST_ASSERT_DOUBLE_EQUAL(1.0, myDataset.data[4]);
+
+    fscl_data_erase(&myDataset);
+}
+
+XTEST_CASE(test_fscl_data_normalize_columns) {
+    cdataset myDataset;
+    fscl_data_create(&myDataset, 6);
+
+    // rows: (1, 100), (2, 100), (3, 100)
+    for (size_t r = 0; r < 3; ++r) {
+        myDataset.data[r * 2] = (double)(r + 1);
+        myDataset.data[r * 2 + 1] = 100.0;
+    }
+
+    fscl_data_normalize_columns(&myDataset, 2);
+    TEST_ASSERT_DOUBLE_EQUAL(0.0, myDataset.data[0]);
+    TEST_ASSERT_DOUBLE_EQUAL(0.5, myDataset.data[2]);
+    TEST_ASSERT_DOUBLE_EQUAL(1.0, myDataset.data[4]);
+    TEST_ASSERT_DOUBLE_EQUAL(0.0, myDataset.data[5]); // constant column
+
+    fscl_data_erase(&myDataset);
+}
+
+XTEST_CASE(test_fscl_data_normalize_features_parallel) {
+    cdataset serial, parallel;
+    fscl_data_create(&serial, 100000);
+    fscl_data_create(&parallel, 100000);
+
+    for (size_t i = 0; i < serial.size; ++i) {
+        serial.data[i] = parallel.data[i] = (double)((i * 7919) % 100000) * 0.37;
+    }
+
+    fscl_data_normalize_features(&serial);
+    fscl_parallel_set_threads(4);
+    fscl_data_normalize_features(&parallel);
+    fscl_parallel_set_threads(1);
+
+    int identical = 1;
+    for (size_t i = 0; i < serial.size; ++i) {
+        if (serial.data[i] != parallel.data[i]) {
+            identical = 0;
+        }
+    }
+    TEST_ASSERT_TRUE(identical);
+
+    fscl_data_erase(&serial);
+    fscl_data_erase(&parallel);
+}
+
+// Large enough to take the pooled path: every element must land on its
+// own (x - min) / (max - min), with the extremes at exactly 0 and 1.
+XTEST_CASE(test_fscl_data_normalize_features_range) {
+    cdataset original, normalized;
+    fscl_data_create(&original, (size_t)1 << 20);
+    fscl_data_create(&normalized, original.size);
+    fscl_data_fill_random(&original);
+    original.data[12345] = NAN;
+    for (size_t i = 0; i < original.size; ++i) {
+        normalized.data[i] = original.data[i];
+    }
+
+    double min = INFINITY, max = -INFINITY;
+    size_t lowest = 0, highest = 0;
+    for (size_t i = 0; i < original.size; ++i) {
+        if (original.data[i] < min) {
+            min = original.data[i];
+            lowest = i;
+        }
+        if (original.data[i] > max) {
+            max = original.data[i];
+            highest = i;
+        }
+    }
+
+    fscl_data_normalize_features(&normalized);
+
+    int in_range = 1;
+    for (size_t i = 0; i < original.size; ++i) {
+        if (isnan(original.data[i])) {
+            in_range &= isnan(normalized.data[i]);
+            continue;
+        }
+        double expected = (original.data[i] - min) / (max - min);
+        in_range &= fabs(normalized.data[i] - expected) <= 1e-12;
+    }
+    TEST_ASSERT_TRUE(in_range);
+    TEST_ASSERT_DOUBLE_EQUAL(0.0, normalized.data[lowest]);
+    TEST_ASSERT_DOUBLE_EQUAL(1.0, normalized.data[highest]);
+
+    fscl_data_erase(&original);
+    fscl_data_erase(&normalized);
+}
+
+// Wall-clock seconds, monotonic where the C library offers it; clock()
+// would add up CPU time across pool threads
+static double wall_seconds(void) {
+    struct timespec now;
+#if defined(TIME_MONOTONIC)
+    timespec_get(&now, TIME_MONOTONIC);
+#else
+    timespec_get(&now, TIME_UTC);
+#endif
+    return (double)now.tv_sec + (double)now.tv_nsec * 1e-9;
+}
+
+// Best of several serial runs, so one preempted run cannot skew the ratio
+static double normalize_seconds(cdataset *dataset) {
+    double best = INFINITY;
+    for (int run = 0; run < 5; ++run) {
+        double start = wall_seconds();
+        fscl_data_normalize_features(dataset);
+        double elapsed = wall_seconds() - start;
+        if (elapsed < best) best = elapsed;
+    }
+    return best;
+}
+
+// Regression benchmark: 16x the elements must cost well under the 256x an
+// O(n^2) loop would take; linear code costs about 16x
+XTEST_CASE(test_fscl_data_normalize_features_scaling) {
+    cdataset small, large;
+    fscl_data_create(&small, (size_t)1 << 16);
+    fscl_data_create(&large, (size_t)1 << 20);
+    fscl_data_fill_random(&small);
+    fscl_data_fill_random(&large);
+
+    fscl_data_set_exec(FSCL_DATA_EXEC_SERIAL);
+    double small_time = normalize_seconds(&small);
+    double large_time = normalize_seconds(&large);
+    fscl_data_set_exec(FSCL_DATA_EXEC_DEFAULT);
+
+    TEST_ASSERT_TRUE(large_time <= 64.0 * small_time + 0.002);
+
+    fscl_data_erase(&small);
+    fscl_data_erase(&large);
+}
+
+XTEST_CASE(test_fscl_data_elementwise_parallel) {
+    cdataset dataset1, dataset2, serial, parallel;
+    fscl_data_create(&dataset1, 70001);
+    fscl_data_create(&dataset2, 70001);
+    fscl_data_create(&serial, 70001);
+    fscl_data_create(&parallel, 70001);
+    fscl_data_fill_random(&dataset1);
+    fscl_data_fill_random(&dataset2);
+
+    fscl_data_subtract_ex(&dataset1, &dataset2, &serial, FSCL_DATA_EXEC_SERIAL);
+    fscl_data_scale_ex(&serial, 0.1, FSCL_DATA_EXEC_SERIAL);
+    fscl_data_subtract_ex(&dataset1, &dataset2, &parallel, FSCL_DATA_EXEC_PARALLEL);
+    fscl_data_scale_ex(&parallel, 0.1, FSCL_DATA_EXEC_PARALLEL);
+
+    int identical = 1;
+    for (size_t i = 0; i < serial.size; ++i) {
+        if (serial.data[i] != parallel.data[i]) {
+            identical = 0;
+        }
+    }
+    TEST_ASSERT_TRUE(identical);
+    TEST_ASSERT_TRUE(fscl_parallel_get_threads() >= 1);
+
+    fscl_data_set_exec(FSCL_DATA_EXEC_SERIAL);
+    TEST_ASSERT_EQUAL_INT(FSCL_DATA_EXEC_SERIAL, fscl_data_get_exec());
+    fscl_data_set_exec(FSCL_DATA_EXEC_DEFAULT);
+    fscl_parallel_set_threads(1);
+
+    fscl_data_erase(&dataset1);
+    fscl_data_erase(&dataset2);
+    fscl_data_erase(&serial);
+    fscl_data_erase(&parallel);
+}
+
+// Records the size of every chunk it is handed
+static void record_chunk(void *context, size_t begin, size_t end) {
+    ((size_t *)context)[begin / 100] = end - begin;
+}
+
+XTEST_CASE(test_fscl_data_for_policy) {
+    size_t sizes[10] = {0};
+
+    // Serial or pooled, the chunks are the same
+    fscl_data_for(FSCL_DATA_EXEC_SERIAL, 950, 100, record_chunk, sizes);
+    TEST_ASSERT_EQUAL_UINT(100, sizes[0]);
+    TEST_ASSERT_EQUAL_UINT(50, sizes[9]);
+    TEST_ASSERT_FALSE(fscl_data_parallel(FSCL_DATA_EXEC_SERIAL));
+
+    // A global parallel policy starts the pool for every module
+    fscl_data_set_exec(FSCL_DATA_EXEC_PARALLEL);
+    fscl_parallel_set_threads(1);
+    memset(sizes, 0, sizeof(sizes));
+    fscl_data_for(FSCL_DATA_EXEC_DEFAULT, 950, 100, record_chunk, sizes);
+    TEST_ASSERT_EQUAL_UINT(100, sizes[0]);
+    TEST_ASSERT_EQUAL_UINT(50, sizes[9]);
+    TEST_ASSERT_EQUAL_UINT(fscl_parallel_cpu_count(), fscl_parallel_get_threads());
+
+    fscl_data_set_exec(FSCL_DATA_EXEC_DEFAULT);
+    fscl_parallel_set_threads(1);
+}
+
+XTEST_CASE(test_fscl_data_index_find) {
+    cdataset myDataset;
+    fscl_data_create(&myDataset, 1000);
+    for (size_t i = 0; i < myDataset.size; ++i) {
+        myDataset.data[i] = (double)((i * 37) % 500);  // every value twice
+    }
+    myDataset.data[7] = NAN;
+    myDataset.data[8] = -0.0;
+
+    // Indexed lookups agree with the linear scan
+    int expected[600];
+    for (int v = 0; v < 600; ++v) {
+        expected[v] = fscl_data_find(&myDataset, (double)v);
+    }
+    TEST_ASSERT_EQUAL_INT(0, fscl_data_index_build(&myDataset));
+    int agree = 1;
+    for (int v = 0; v < 600; ++v) {
+        if (fscl_data_find(&myDataset, (double)v) != expected[v]) {
+            agree = 0;
+        }
+    }
+    TEST_ASSERT_TRUE(agree);
+    TEST_ASSERT_EQUAL_INT(-1, fscl_data_find(&myDataset, NAN));
+
+    size_t positions[8];
+    TEST_ASSERT_EQUAL_UINT(6, fscl_data_find_range(&myDataset, 10.0, 12.0, positions, 8));
+    TEST_ASSERT_DOUBLE_EQUAL(10.0, myDataset.data[positions[0]]);
+    TEST_ASSERT_DOUBLE_EQUAL(12.0, myDataset.data[positions[5]]);
+
+    // Mutators drop the index, so lookups see the new values
+    fscl_data_scale(&myDataset, 2.0);
+    TEST_ASSERT_TRUE(myDataset.ext == NULL);
+    TEST_ASSERT_EQUAL_INT(expected[300], fscl_data_find(&myDataset, 600.0));
+    TEST_ASSERT_EQUAL_UINT(6, fscl_data_find_range(&myDataset, 20.0, 24.0, positions, 8));
+
+    fscl_data_erase(&myDataset);
+}
+
+static void release_counted(void *storage) {
+    ++*(int *)storage;
+}
+
+XTEST_CASE(test_fscl_data_ext_lifecycle) {
+    // A view over caller memory is back to {data, size, NULL} once the
+    // library extras are dropped
+    double values[] = {3.0, 1.0, 2.0};
+    cdataset view = {values, 3, NULL};
+    TEST_ASSERT_EQUAL_INT(0, fscl_data_index_build(&view));
+    TEST_ASSERT_EQUAL_INT(0, fscl_data_zones_build(&view));
+    TEST_ASSERT_EQUAL_INT(2, fscl_data_find(&view, 2.0));
+    fscl_data_index_drop(&view);
+    TEST_ASSERT_TRUE(view.ext != NULL);
+    fscl_data_zones_drop(&view);
+    TEST_ASSERT_TRUE(view.ext == NULL);
+    TEST_ASSERT_TRUE(fscl_data_storage_get(&view) == NULL);
+
+    // Erasing a dataset with an owner releases through the owner
+    int released = 0;
+    cdataset owned = {values, 3, NULL};
+    TEST_ASSERT_EQUAL_INT(0, fscl_data_storage_attach(&owned, &released, release_counted));
+    TEST_ASSERT_TRUE(fscl_data_storage_get(&owned) == &released);
+    TEST_ASSERT_EQUAL_INT(0, fscl_data_zones_build(&owned));
+    fscl_data_erase(&owned);
+    TEST_ASSERT_EQUAL_INT(1, released);
+    TEST_ASSERT_TRUE(owned.ext == NULL && owned.data == NULL);
+}
+
+XTEST_CASE(test_fscl_data_zones_find_range) {
+    cdataset myDataset;
+    fscl_data_create(&myDataset, 20000);
+    for (size_t i = 0; i < myDataset.size; ++i) {
+        myDataset.data[i] = (double)i;  // sorted, so most blocks are skipped
+    }
+    for (size_t i = 4096; i < 8192; ++i) {
+        myDataset.data[i] = NAN;        // one all-NaN block
+    }
+
+    TEST_ASSERT_EQUAL_INT(0, fscl_data_zones_build(&myDataset));
+    size_t positions[4];
+    TEST_ASSERT_EQUAL_UINT(11, fscl_data_find_range(&myDataset, 12000.0, 12010.0, positions, 4));
+    TEST_ASSERT_EQUAL_UINT(12000, positions[0]);
+    TEST_ASSERT_EQUAL_UINT(0, fscl_data_find_range(&myDataset, 5000.0, 6000.0, positions, 4));
+    TEST_ASSERT_EQUAL_INT(19999, fscl_data_find(&myDataset, 19999.0));
+    TEST_ASSERT_DOUBLE_EQUAL(19999.0, fscl_data_max(&myDataset));
+
+    // Mutators keep the zones current
+    fscl_data_scale(&myDataset, -1.0);
+    TEST_ASSERT_TRUE(myDataset.ext != NULL);
+    TEST_ASSERT_EQUAL_UINT(11, fscl_data_find_range(&myDataset, -12010.0, -12000.0, positions, 4));
+    TEST_ASSERT_DOUBLE_EQUAL(-19999.0, fscl_data_min(&myDataset));
+    fscl_data_remove_missing(&myDataset);
+    TEST_ASSERT_EQUAL_INT(4096, fscl_data_find(&myDataset, -8192.0));
+
+    // Direct writes are reported with fscl_data_zones_update
+    myDataset.data[10] = 1.0e9;
+    TEST_ASSERT_EQUAL_INT(0, fscl_data_zones_update(&myDataset, 10, 11));
+    TEST_ASSERT_DOUBLE_EQUAL(1.0e9, fscl_data_max(&myDataset));
+
+    fscl_data_erase(&myDataset);
+    TEST_ASSERT_TRUE(myDataset.ext == NULL);
+}
+
+XTEST_CASE(test_fscl_data_stats_batch) {
+    // 1000 ragged series, including empty and all-NaN ones
+    size_t offsets[1001];
+    offsets[0] = 0;
+    for (size_t s = 0; s < 1000; ++s) {
+        offsets[s + 1] = offsets[s] + (s * 37) % 300;
+    }
+    double *values = (double *)malloc(offsets[1000] * sizeof(double));
+    for (size_t i = 0; i < offsets[1000]; ++i) {
+        values[i] = (double)((i * 7919) % 1000) / 7.0;
+    }
+    values[offsets[5]] = NAN;
+    for (size_t i = offsets[3]; i < offsets[4]; ++i) {
+        values[i] = NAN;
+    }
+
+    cdataset_stats *batch = (cdataset_stats *)malloc(1000 * sizeof(cdataset_stats));
+    fscl_parallel_set_threads(4);
+    fscl_data_stats_batch(values, offsets, 1000, batch);
+    fscl_parallel_set_threads(1);
+
+    int agree = 1;
+    for (size_t s = 0; s < 1000; ++s) {
+        cdataset series = {values + offsets[s], offsets[s + 1] - offsets[s], NULL};
+        cdataset_stats single;
+        fscl_data_stats(&series, &single);
+        if (batch[s].count != single.count || batch[s].nan_count != single.nan_count) {
+            agree = 0;
+        } else if (single.count > 0 && (fabs(batch[s].mean - single.mean) > 1e-9 ||
+                   fabs(batch[s].variance - single.variance) > 1e-6 ||
+                   batch[s].min != single.min || batch[s].max != single.max)) {
+            agree = 0;
+        }
+    }
+    TEST_ASSERT_TRUE(agree);
+    TEST_ASSERT_TRUE(isnan(batch[0].mean));     // empty series
+    TEST_ASSERT_EQUAL_UINT(111, batch[3].nan_count);
+
+    free(batch);
+    free(values);
+}
+
 //
 // XUNIT-GROUP: a group of test cases from the current test file
 //
@@ -119,4 +575,19 @@ XTEST_DEFINE_POOL(test_dataset_group) {
     XTEST_RUN_UNIT(test_fscl_data_mean);
     XTEST_RUN_UNIT(test_fscl_data_add);
     XTEST_RUN_UNIT(test_fscl_data_multiply);
+    XTEST_RUN_UNIT(test_fscl_data_reductions);
+    XTEST_RUN_UNIT(test_fscl_data_stats);
+    XTEST_RUN_UNIT(test_fscl_data_stats_batch);
+    XTEST_RUN_UNIT(test_fscl_data_standardize_and_outliers);
+    XTEST_RUN_UNIT(test_fscl_data_remove_missing);
+    XTEST_RUN_UNIT(test_fscl_data_normalize_features);
+    XTEST_RUN_UNIT(test_fscl_data_normalize_columns);
+    XTEST_RUN_UNIT(test_fscl_data_normalize_features_parallel);
+    XTEST_RUN_UNIT(test_fscl_data_normalize_features_range);
+    XTEST_RUN_UNIT(test_fscl_data_normalize_features_scaling);
+    XTEST_RUN_UNIT(test_fscl_data_elementwise_parallel);
+    XTEST_RUN_UNIT(test_fscl_data_for_policy);
+    XTEST_RUN_UNIT(test_fscl_data_index_find);
+    XTEST_RUN_UNIT(test_fscl_data_ext_lifecycle);
+    XTEST_RUN_UNIT(test_fscl_data_zones_find_range);
 } // end of fixture
\ No newline at end of file
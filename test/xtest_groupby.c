@@ -0,0 +1,100 @@
+/*
+==============================================================================
+Author: Michael Gene Brockus (Dreamer)
+Email: michaelbrockus@gmail.com
+Organization: Fossil Logic
+Description: 
+    This file is part of the Fossil Logic project, where innovation meets
+    excellence in software development. Michael Gene Brockus, also known as
+    "Dreamer," is a dedicated contributor to this project. For any inquiries,
+    feel free to contact Michael at michaelbrockus@gmail.com.
+==============================================================================
+*/
+#include <fossil/xtest.h>   // basic test tools
+#include <fossil/xassert.h> // extra asserts
+
+#include <fossil/xscience/groupby.h> // library under test
+#include <fossil/xscience/parallel.h>
+#include <string.h>
+
+//
+// XUNIT-CASES: list of test cases testing project features
+//
+
+XTEST_CASE(test_fscl_data_group_by) {
+    double keyData[] = {3.0, 1.0, 3.0, NAN, -2.0, 1.0, 3.0};
+    double valueData[] = {1.0, 2.0, 3.0, 100.0, 5.0, NAN, 8.0};
+    cdataset keys = {keyData, 7, NULL};
+    cdataset values = {valueData, 7, NULL};
+    cgroupby result;
+
+    TEST_ASSERT_EQUAL(0, fscl_data_group_by(&keys, &values, 1, &result));
+    TEST_ASSERT_EQUAL(3, result.keys.size);
+    TEST_ASSERT_DOUBLE_EQUAL(-2.0, result.keys.data[0]);
+    TEST_ASSERT_DOUBLE_EQUAL(1.0, result.keys.data[1]);
+    TEST_ASSERT_DOUBLE_EQUAL(3.0, result.keys.data[2]);
+    TEST_ASSERT_DOUBLE_EQUAL(2.0, result.counts.data[1]);
+    TEST_ASSERT_DOUBLE_EQUAL(3.0, result.counts.data[2]);
+    TEST_ASSERT_DOUBLE_EQUAL(12.0, result.sums[0].data[2]);
+    TEST_ASSERT_DOUBLE_EQUAL(4.0, result.means[0].data[2]);
+
+    // NaN values count as rows but stay out of the sums and means
+    TEST_ASSERT_DOUBLE_EQUAL(2.0, result.sums[0].data[1]);
+    TEST_ASSERT_DOUBLE_EQUAL(2.0, result.means[0].data[1]);
+    fscl_group_by_erase(&result);
+
+    keyData[0] = 0.5;
+    TEST_ASSERT_EQUAL(-1, fscl_data_group_by(&keys, &values, 1, &result));
+}
+
+// Compares a group-by of `size` rows over `cardinality` keys with known sums
+static int group_by_matches(size_t size, size_t cardinality) {
+    cdataset keys, values[2];
+    cgroupby result;
+    int ok = 1;
+
+    fscl_data_create(&keys, size);
+    fscl_data_create(&values[0], size);
+    fscl_data_create(&values[1], size);
+    for (size_t i = 0; i < size; ++i) {
+        keys.data[i] = (double)((i * 7919) % cardinality);
+        values[0].data[i] = 1.0;
+        values[1].data[i] = (double)(i % 4);
+    }
+
+    ok &= fscl_data_group_by(&keys, values, 2, &result) == 0;
+    ok &= result.keys.size == cardinality;
+    for (size_t g = 0; ok && g < cardinality; ++g) {
+        ok &= result.keys.data[g] == (double)g;
+        ok &= result.sums[0].data[g] == result.counts.data[g];
+    }
+    double total = 0.0;
+    for (size_t g = 0; ok && g < cardinality; ++g) {
+        total += result.sums[1].data[g];
+    }
+    ok &= total == (double)(size / 4 * 6 + (size % 4) * (size % 4 - 1) / 2);
+
+    fscl_group_by_erase(&result);
+    fscl_data_erase(&keys);
+    fscl_data_erase(&values[0]);
+    fscl_data_erase(&values[1]);
+    return ok;
+}
+
+XTEST_CASE(test_fscl_data_group_by_cardinality) {
+    // Few keys use per-chunk tables, many keys the partitioned pass
+    TEST_ASSERT_TRUE(group_by_matches(300000, 17));
+    TEST_ASSERT_TRUE(group_by_matches(300000, 100000));
+    fscl_parallel_set_threads(4);
+    TEST_ASSERT_TRUE(group_by_matches(300000, 17));
+    TEST_ASSERT_TRUE(group_by_matches(300000, 100000));
+    fscl_parallel_set_threads(1);
+}
+
+//
+// XUNIT-GROUP: a group of test cases from the current test file
+//
+XTEST_DEFINE_POOL(test_groupby_group) {
+    XTEST_RUN_UNIT(test_fscl_data_group_by);
+    XTEST_RUN_UNIT(test_fscl_data_group_by_cardinality);
+} // end of fixture
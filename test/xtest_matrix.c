@@ -0,0 +1,200 @@
+/*
+==============================================================================
+Author: Michael Gene Brockus (Dreamer)
+Email: michaelbrockus@gmail.com
+Organization: Fossil Logic
+Description: 
+    This file is part of the Fossil Logic project, where innovation meets
+    excellence in software development. Michael Gene Brockus, also known as
+    "Dreamer," is a dedicated contributor to this project. For any inquiries,
+    feel free to contact Michael at michaelbrockus@gmail.com.
+==============================================================================
+*/
+#include <fossil/xtest.h>   // basic test tools
+#include <fossil/xassert.h> // extra asserts
+
+#include <fossil/xscience/matrix.h> // library under test
+#include <fossil/xscience/random.h>
+#include <fossil/xscience/parallel.h>
+#include <string.h>
+
+//
+// XUNIT-CASES: list of test cases testing project features
+//
+
+XTEST_CASE(test_fscl_matrix_view) {
+    double values[] = {1.0, 2.0, 3.0, 4.0, 5.0, 6.0};
+    cdataset myDataset = {values, 6, NULL};
+    cmatrix matrix, block;
+
+    TEST_ASSERT_EQUAL(-1, fscl_matrix_view(&matrix, &myDataset, 4, 2, FSCL_MATRIX_ROW_MAJOR));
+    TEST_ASSERT_EQUAL(0, fscl_matrix_view(&matrix, &myDataset, 2, 3, FSCL_MATRIX_ROW_MAJOR));
+    TEST_ASSERT_DOUBLE_EQUAL(6.0, fscl_matrix_get(&matrix, 1, 2));
+
+    fscl_matrix_transpose(&matrix);
+    TEST_ASSERT_EQUAL(3, matrix.rows);
+    TEST_ASSERT_DOUBLE_EQUAL(6.0, fscl_matrix_get(&matrix, 2, 1));
+    TEST_ASSERT_DOUBLE_EQUAL(2.0, fscl_matrix_get(&matrix, 1, 0));
+
+    TEST_ASSERT_EQUAL(0, fscl_matrix_block(&block, &matrix, 1, 1, 2, 1));
+    TEST_ASSERT_DOUBLE_EQUAL(5.0, fscl_matrix_get(&block, 0, 0));
+    TEST_ASSERT_DOUBLE_EQUAL(6.0, fscl_matrix_get(&block, 1, 0));
+    TEST_ASSERT_EQUAL(-1, fscl_matrix_block(&block, &matrix, 2, 0, 2, 1));
+}
+
+// Checks y = A * x + y for a matrix in the given layout
+static int gemv_matches(size_t rows, size_t cols, cmatrix_layout layout) {
+    cdataset storage, x, y;
+    cmatrix a;
+    int ok = 1;
+
+    fscl_data_create(&storage, rows * cols);
+    fscl_data_create(&x, cols);
+    fscl_data_create(&y, rows);
+    fscl_data_fill_random_ex(&storage, 1, FSCL_RANDOM_UNIFORM, -1.0, 1.0);
+    fscl_data_fill_random_ex(&x, 2, FSCL_RANDOM_UNIFORM, -1.0, 1.0);
+    fscl_data_fill_random_ex(&y, 3, FSCL_RANDOM_UNIFORM, -1.0, 1.0);
+    fscl_matrix_view(&a, &storage, rows, cols, layout);
+
+    double expected[3];
+    size_t checks[3] = {0, rows / 2, rows - 1};
+    for (size_t c = 0; c < 3; ++c) {
+        expected[c] = 0.5 * y.data[checks[c]];
+        for (size_t j = 0; j < cols; ++j) {
+            expected[c] += 2.0 * fscl_matrix_get(&a, checks[c], j) * x.data[j];
+        }
+    }
+    ok &= fscl_matrix_gemv(2.0, &a, &x, 0.5, &y) == 0;
+    for (size_t c = 0; c < 3; ++c) {
+        ok &= fabs(y.data[checks[c]] - expected[c]) < 1e-9;
+    }
+
+    fscl_data_erase(&storage);
+    fscl_data_erase(&x);
+    fscl_data_erase(&y);
+    return ok;
+}
+
+XTEST_CASE(test_fscl_matrix_gemv) {
+    TEST_ASSERT_TRUE(gemv_matches(1027, 4099, FSCL_MATRIX_ROW_MAJOR));
+    TEST_ASSERT_TRUE(gemv_matches(1027, 4099, FSCL_MATRIX_COL_MAJOR));
+    TEST_ASSERT_TRUE(gemv_matches(3, 2, FSCL_MATRIX_ROW_MAJOR));
+}
+
+// Checks C = A * B against a direct triple loop
+static int gemm_matches(size_t m, size_t n, size_t k, cmatrix_layout la, cmatrix_layout lb, cmatrix_layout lc) {
+    cdataset sa, sb, sc;
+    cmatrix a, b, c;
+    int ok = 1;
+
+    fscl_data_create(&sa, m * k);
+    fscl_data_create(&sb, k * n);
+    fscl_data_create(&sc, m * n);
+    fscl_data_fill_random_ex(&sa, 4, FSCL_RANDOM_UNIFORM, -1.0, 1.0);
+    fscl_data_fill_random_ex(&sb, 5, FSCL_RANDOM_UNIFORM, -1.0, 1.0);
+    fscl_data_fill_random_ex(&sc, 6, FSCL_RANDOM_UNIFORM, -1.0, 1.0);
+    fscl_matrix_view(&a, &sa, m, k, la);
+    fscl_matrix_view(&b, &sb, k, n, lb);
+    fscl_matrix_view(&c, &sc, m, n, lc);
+
+    ok &= fscl_matrix_gemm(1.0, &a, &b, 0.0, &c) == 0;
+    for (size_t i = 0; i < m; i += 7) {
+        for (size_t j = 0; j < n; j += 5) {
+            double expected = 0.0;
+            for (size_t p = 0; p < k; ++p) {
+                expected += fscl_matrix_get(&a, i, p) * fscl_matrix_get(&b, p, j);
+            }
+            ok &= fabs(fscl_matrix_get(&c, i, j) - expected) < 1e-9;
+        }
+    }
+
+    fscl_data_erase(&sa);
+    fscl_data_erase(&sb);
+    fscl_data_erase(&sc);
+    return ok;
+}
+
+XTEST_CASE(test_fscl_matrix_gemm) {
+    // Sizes straddle the register tile and the cache blocks
+    TEST_ASSERT_TRUE(gemm_matches(1, 1, 1, FSCL_MATRIX_ROW_MAJOR, FSCL_MATRIX_ROW_MAJOR, FSCL_MATRIX_ROW_MAJOR));
+    TEST_ASSERT_TRUE(gemm_matches(13, 17, 300, FSCL_MATRIX_ROW_MAJOR, FSCL_MATRIX_COL_MAJOR, FSCL_MATRIX_ROW_MAJOR));
+    TEST_ASSERT_TRUE(gemm_matches(203, 2057, 19, FSCL_MATRIX_COL_MAJOR, FSCL_MATRIX_ROW_MAJOR, FSCL_MATRIX_COL_MAJOR));
+    fscl_parallel_set_threads(4);
+    TEST_ASSERT_TRUE(gemm_matches(301, 97, 513, FSCL_MATRIX_ROW_MAJOR, FSCL_MATRIX_ROW_MAJOR, FSCL_MATRIX_ROW_MAJOR));
+    fscl_parallel_set_threads(1);
+
+    // Accumulating into C with beta
+    double av[] = {1.0, 2.0, 3.0, 4.0}, bv[] = {5.0, 6.0, 7.0, 8.0}, cv[] = {1.0, 1.0, 1.0, 1.0};
+    cdataset da = {av, 4, NULL}, db = {bv, 4, NULL}, dc = {cv, 4, NULL};
+    cmatrix a, b, c;
+    fscl_matrix_view(&a, &da, 2, 2, FSCL_MATRIX_ROW_MAJOR);
+    fscl_matrix_view(&b, &db, 2, 2, FSCL_MATRIX_ROW_MAJOR);
+    fscl_matrix_view(&c, &dc, 2, 2, FSCL_MATRIX_ROW_MAJOR);
+    TEST_ASSERT_EQUAL(0, fscl_matrix_gemm(1.0, &a, &b, 2.0, &c));
+    TEST_ASSERT_DOUBLE_EQUAL(21.0, cv[0]);
+    TEST_ASSERT_DOUBLE_EQUAL(24.0, cv[1]);
+    TEST_ASSERT_DOUBLE_EQUAL(45.0, cv[2]);
+    TEST_ASSERT_DOUBLE_EQUAL(52.0, cv[3]);
+
+    cmatrix row;
+    fscl_matrix_block(&row, &c, 0, 0, 1, 2);
+    TEST_ASSERT_EQUAL(-1, fscl_matrix_gemm(1.0, &row, &row, 0.0, &c));
+}
+
+XTEST_CASE(test_fscl_data_covariance_matrix) {
+    const size_t num_columns = 150, rows = 2000;
+    cdataset columns[150], covariance, serial, correlation;
+
+    for (size_t j = 0; j < num_columns; ++j) {
+        fscl_data_create(&columns[j], rows);
+        fscl_data_fill_random_ex(&columns[j], j, FSCL_RANDOM_NORMAL, (double)j, 1.0);
+    }
+    // Column 1 follows column 0, column 2 is constant
+    for (size_t i = 0; i < rows; ++i) {
+        columns[1].data[i] = 3.0 * columns[0].data[i] + 1.0;
+        columns[2].data[i] = 5.0;
+    }
+
+    TEST_ASSERT_EQUAL(0, fscl_data_covariance_matrix(columns, num_columns, &serial));
+    fscl_parallel_set_threads(4);
+    TEST_ASSERT_EQUAL(0, fscl_data_covariance_matrix(columns, num_columns, &covariance));
+    fscl_parallel_set_threads(1);
+    TEST_ASSERT_TRUE(memcmp(serial.data, covariance.data, serial.size * sizeof(double)) == 0);
+
+    // Compare a few entries against the definition
+    const size_t pairs[][2] = {{0, 0}, {3, 7}, {149, 64}, {63, 64}, {120, 5}};
+    for (size_t p = 0; p < 5; ++p) {
+        size_t a = pairs[p][0], b = pairs[p][1];
+        double mean_a = fscl_data_mean(&columns[a]), mean_b = fscl_data_mean(&columns[b]);
+        double expected = 0.0;
+        for (size_t i = 0; i < rows; ++i) {
+            expected += (columns[a].data[i] - mean_a) * (columns[b].data[i] - mean_b);
+        }
+        expected /= (double)rows;
+        TEST_ASSERT_TRUE(fabs(covariance.data[a * num_columns + b] - expected) < 1e-9);
+        TEST_ASSERT_DOUBLE_EQUAL(covariance.data[a * num_columns + b], covariance.data[b * num_columns + a]);
+    }
+
+    TEST_ASSERT_EQUAL(0, fscl_data_correlation_matrix(columns, num_columns, &correlation));
+    TEST_ASSERT_DOUBLE_EQUAL(1.0, correlation.data[0 * num_columns + 1]);
+    TEST_ASSERT_DOUBLE_EQUAL(1.0, correlation.data[5 * num_columns + 5]);
+    TEST_ASSERT_TRUE(isnan(correlation.data[2 * num_columns + 7]));
+    TEST_ASSERT_TRUE(fabs(correlation.data[3 * num_columns + 7]) < 0.1);
+
+    fscl_data_erase(&serial);
+    fscl_data_erase(&covariance);
+    fscl_data_erase(&correlation);
+    for (size_t j = 0; j < num_columns; ++j) {
+        fscl_data_erase(&columns[j]);
+    }
+}
+
+//
+// XUNIT-GROUP: a group of test cases from the current test file
+//
+XTEST_DEFINE_POOL(test_matrix_group) {
+    XTEST_RUN_UNIT(test_fscl_matrix_view);
+    XTEST_RUN_UNIT(test_fscl_matrix_gemv);
+    XTEST_RUN_UNIT(test_fscl_matrix_gemm);
+    XTEST_RUN_UNIT(test_fscl_data_covariance_matrix);
+} // end of fixture
@@ -0,0 +1,124 @@
+/*
+==============================================================================
+Author: Michael Gene Brockus (Dreamer)
+Email: michaelbrockus@gmail.com
+Organization: Fossil Logic
+Description: 
+    This file is part of the Fossil Logic project, where innovation meets
+    excellence in software development. Michael Gene Brockus, also known as
+    "Dreamer," is a dedicated contributor to this project. For any inquiries,
+    feel free to contact Michael at michaelbrockus@gmail.com.
+==============================================================================
+*/
+#include <fossil/xtest.h>   // basic test tools
+#include <fossil/xassert.h> // extra asserts
+
+#include <fossil/xscience/parallel.h> // library under test
+#include <stdlib.h>
+
+#if defined(_WIN32)
+#include <windows.h>
+#else
+#include <pthread.h>
+#endif
+
+//
+// XUNIT-CASES: list of test cases testing project features
+//
+
+// Marks every element of a chunk once
+static void mark_chunk(void *context, size_t begin, size_t end) {
+    int *marks = (int *)context;
+    for (size_t i = begin; i < end; ++i) {
+        marks[i] += 1;
+    }
+}
+
+XTEST_CASE(test_fscl_parallel_default_serial) {
+    TEST_ASSERT_EQUAL_UINT(1, fscl_parallel_get_threads());
+    TEST_ASSERT_TRUE(fscl_parallel_cpu_count() >= 1);
+}
+
+XTEST_CASE(test_fscl_parallel_for_covers_range) {
+    size_t count = 100003;
+    int *marks = (int *)calloc(count, sizeof(int));
+
+    fscl_parallel_set_threads(4);
+    TEST_ASSERT_EQUAL_UINT(4, fscl_parallel_get_threads());
+
+    fscl_parallel_for(count, 1000, mark_chunk, marks);
+    fscl_parallel_for(count, 1000, mark_chunk, marks);
+
+    int all_twice = 1;
+    for (size_t i = 0; i < count; ++i) {
+        if (marks[i] != 2) {
+            all_twice = 0;
+        }
+    }
+    TEST_ASSERT_TRUE(all_twice);
+
+    fscl_parallel_shutdown();
+    fscl_parallel_set_threads(1);
+    free(marks);
+}
+
+// Resizes the pool back and forth while another thread runs loops
+#if defined(_WIN32)
+static DWORD WINAPI resize_pool(LPVOID context) {
+#else
+static void *resize_pool(void *context) {
+#endif
+    (void)context;
+    for (int round = 0; round < 200; ++round) {
+        fscl_parallel_set_threads(round % 2 == 0 ? 2 : 3);
+    }
+    return 0;
+}
+
+XTEST_CASE(test_fscl_parallel_for_concurrent_resize) {
+    size_t count = 20000;
+    int *marks = (int *)calloc(count, sizeof(int));
+    fscl_parallel_set_threads(2);
+
+#if defined(_WIN32)
+    HANDLE resizer = CreateThread(NULL, 0, resize_pool, NULL, 0, NULL);
+    int started = resizer != NULL;
+#else
+    pthread_t resizer;
+    int started = pthread_create(&resizer, NULL, resize_pool, NULL) == 0;
+#endif
+
+    // Every loop covers the range once, whatever size the pool has
+    for (int loop = 0; loop < 200; ++loop) {
+        fscl_parallel_for(count, 500, mark_chunk, marks);
+    }
+    if (started) {
+#if defined(_WIN32)
+        WaitForSingleObject(resizer, INFINITE);
+        CloseHandle(resizer);
+#else
+        pthread_join(resizer, NULL);
+#endif
+    }
+
+    int all_covered = 1;
+    for (size_t i = 0; i < count; ++i) {
+        if (marks[i] != 200) {
+            all_covered = 0;
+        }
+    }
+    TEST_ASSERT_TRUE(all_covered);
+
+    fscl_parallel_shutdown();
+    fscl_parallel_set_threads(1);
+    free(marks);
+}
+
+//
+// XUNIT-GROUP: a group of test cases from the current test file
+//
+XTEST_DEFINE_POOL(test_parallel_group) {
+    XTEST_RUN_UNIT(test_fscl_parallel_default_serial);
+    XTEST_RUN_UNIT(test_fscl_parallel_for_covers_range);
+    XTEST_RUN_UNIT(test_fscl_parallel_for_concurrent_resize);
+} // end of fixture
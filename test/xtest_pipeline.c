@@ -0,0 +1,84 @@
+/*
+==============================================================================
+Author: Michael Gene Brockus (Dreamer)
+Email: michaelbrockus@gmail.com
+Organization: Fossil Logic
+Description: 
+    This file is part of the Fossil Logic project, where innovation meets
+    excellence in software development. Michael Gene Brockus, also known as
+    "Dreamer," is a dedicated contributor to this project. For any inquiries,
+    feel free to contact Michael at michaelbrockus@gmail.com.
+==============================================================================
+*/
+#include <fossil/xtest.h>   // basic test tools
+#include <fossil/xassert.h> // extra asserts
+
+#include <fossil/xscience/pipeline.h> // library under test
+
+//
+// XUNIT-CASES: list of test cases testing project features
+//
+
+XTEST_CASE(test_fscl_pipeline_matches_eager) {
+    cdataset eager, lazy;
+    fscl_data_create(&eager, 1000);
+    fscl_data_create(&lazy, 1000);
+    for (size_t i = 0; i < eager.size; ++i) {
+        eager.data[i] = lazy.data[i] = i % 10 == 0 ? NAN : (double)((i * 31) % 97);
+    }
+
+    fscl_data_replace_missing(&eager, 50.0);
+    fscl_data_scale(&eager, 3.0);
+    fscl_data_standardize(&eager);
+    fscl_data_normalize(&eager);
+
+    cpipeline pipeline;
+    fscl_pipeline_create(&pipeline);
+    fscl_pipeline_replace_missing(&pipeline, 50.0);
+    fscl_pipeline_scale(&pipeline, 3.0);
+    fscl_pipeline_standardize(&pipeline);
+    fscl_pipeline_normalize(&pipeline);
+    TEST_ASSERT_EQUAL_UINT(2, fscl_pipeline_run(&pipeline, &lazy));
+
+    int matches = 1;
+    for (size_t i = 0; i < eager.size; ++i) {
+        if (fabs(eager.data[i] - lazy.data[i]) > 1e-12) {
+            matches = 0;
+        }
+    }
+    TEST_ASSERT_TRUE(matches);
+
+    fscl_pipeline_erase(&pipeline);
+    fscl_data_erase(&eager);
+    fscl_data_erase(&lazy);
+}
+
+XTEST_CASE(test_fscl_pipeline_elementwise_only) {
+    cdataset myDataset;
+    fscl_data_create(&myDataset, 3);
+    myDataset.data[0] = 1.0;
+    myDataset.data[1] = NAN;
+    myDataset.data[2] = 3.0;
+
+    cpipeline pipeline;
+    fscl_pipeline_create(&pipeline);
+    fscl_pipeline_scale(&pipeline, 2.0);
+    fscl_pipeline_replace_missing(&pipeline, 0.0);
+    fscl_pipeline_offset(&pipeline, 1.0);
+    TEST_ASSERT_EQUAL_UINT(1, fscl_pipeline_run(&pipeline, &myDataset));
+
+    TEST_ASSERT_DOUBLE_EQUAL(3.0, myDataset.data[0]);
+    TEST_ASSERT_DOUBLE_EQUAL(1.0, myDataset.data[1]);
+    TEST_ASSERT_DOUBLE_EQUAL(7.0, myDataset.data[2]);
+
+    fscl_pipeline_erase(&pipeline);
+    fscl_data_erase(&myDataset);
+}
+
+//
+// XUNIT-GROUP: a group of test cases from the current test file
+//
+XTEST_DEFINE_POOL(test_pipeline_group) {
+    XTEST_RUN_UNIT(test_fscl_pipeline_matches_eager);
+    XTEST_RUN_UNIT(test_fscl_pipeline_elementwise_only);
+} // end of fixture
@@ -0,0 +1,174 @@
+/*
+==============================================================================
+Author: Michael Gene Brockus (Dreamer)
+Email: michaelbrockus@gmail.com
+Organization: Fossil Logic
+Description: 
+    This file is part of the Fossil Logic project, where innovation meets
+    excellence in software development. Michael Gene Brockus, also known as
+    "Dreamer," is a dedicated contributor to this project. For any inquiries,
+    feel free to contact Michael at michaelbrockus@gmail.com.
+==============================================================================
+*/
+#include <fossil/xtest.h>   // basic test tools
+#include <fossil/xassert.h> // extra asserts
+
+#include <fossil/xscience/quantile.h> // library under test
+#include <fossil/xscience/parallel.h>
+
+//
+// XUNIT-CASES: list of test cases testing project features
+//
+
+XTEST_CASE(test_fscl_data_quantile_exact) {
+    double values[] = {4.0, NAN, 1.0, 3.0, 2.0};
+    cdataset myDataset = {values, 5, NULL};
+
+    TEST_ASSERT_DOUBLE_EQUAL(2.5, fscl_data_quantile(&myDataset, 0.5));
+    TEST_ASSERT_DOUBLE_EQUAL(1.0, fscl_data_quantile(&myDataset, 0.0));
+    TEST_ASSERT_DOUBLE_EQUAL(4.0, fscl_data_quantile(&myDataset, 1.0));
+    TEST_ASSERT_DOUBLE_EQUAL(1.75, fscl_data_quantile(&myDataset, 0.25));
+    TEST_ASSERT_DOUBLE_EQUAL(4.0, values[0]); // input is left untouched
+}
+
+XTEST_CASE(test_fscl_data_quantiles) {
+    double values[] = {7.0, NAN, 1.0, 3.0, 5.0, 9.0};
+    cdataset myDataset = {values, 6, NULL};
+    double q[] = {0.0, 0.25, 0.9, 1.0, NAN};
+    double results[5];
+
+    TEST_ASSERT_DOUBLE_EQUAL(5.0, fscl_data_median(&myDataset));
+    TEST_ASSERT_EQUAL(0, fscl_data_quantiles(&myDataset, q, 5, results));
+    TEST_ASSERT_DOUBLE_EQUAL(1.0, results[0]);
+    TEST_ASSERT_DOUBLE_EQUAL(3.0, results[1]);
+    TEST_ASSERT_DOUBLE_EQUAL(8.2, results[2]);
+    TEST_ASSERT_DOUBLE_EQUAL(9.0, results[3]);
+    TEST_ASSERT_TRUE(isnan(results[4]));
+    for (size_t p = 0; p < 4; ++p) {
+        TEST_ASSERT_DOUBLE_EQUAL(fscl_data_quantile(&myDataset, q[p]), results[p]);
+    }
+
+    cdataset empty = {values + 1, 1, NULL};
+    TEST_ASSERT_TRUE(isnan(fscl_data_median(&empty)));
+    TEST_ASSERT_EQUAL(0, fscl_data_quantiles(&empty, q, 2, results));
+    TEST_ASSERT_TRUE(isnan(results[0]) && isnan(results[1]));
+}
+
+XTEST_CASE(test_fscl_sketch_rank_error) {
+    cquantile_sketch sketch;
+    fscl_sketch_create(&sketch, 200);
+    for (size_t i = 0; i < 100000; ++i) {
+        fscl_sketch_update(&sketch, (double)((i * 7919) % 100000));
+    }
+
+    TEST_ASSERT_EQUAL_UINT(100000, sketch.count);
+    TEST_ASSERT_DOUBLE_EQUAL(0.0, fscl_sketch_quantile(&sketch, 0.0));
+    TEST_ASSERT_DOUBLE_EQUAL(99999.0, fscl_sketch_quantile(&sketch, 1.0));
+    for (int p = 1; p < 10; ++p) {
+        double estimate = fscl_sketch_quantile(&sketch, p / 10.0);
+        TEST_ASSERT_TRUE(fabs(estimate - p * 10000.0) < 2000.0);
+    }
+
+    // Memory stays bounded far below the number of values seen
+    size_t retained = 0;
+    for (size_t h = 0; h < sketch.levels; ++h) {
+        retained += sketch.sizes[h];
+    }
+    TEST_ASSERT_TRUE(retained < 1000);
+    fscl_sketch_erase(&sketch);
+}
+
+XTEST_CASE(test_fscl_sketch_deep) {
+    cquantile_sketch sketch;
+    fscl_sketch_create(&sketch, 16);
+    for (size_t i = 0; i < 2000000; ++i) {
+        fscl_sketch_update(&sketch, (double)((i * 7919) % 2000000));
+    }
+    TEST_ASSERT_TRUE(sketch.levels > 15);
+
+    // Every level above the input buffer is kept sorted and within budget
+    size_t retained = 0;
+    int sorted = 1;
+    for (size_t h = 0; h < sketch.levels; ++h) {
+        retained += sketch.sizes[h];
+        for (size_t i = 1; h > 0 && i < sketch.sizes[h]; ++i) {
+            sorted &= sketch.items[h][i - 1] <= sketch.items[h][i];
+        }
+    }
+    TEST_ASSERT_TRUE(sorted);
+    TEST_ASSERT_TRUE(retained <= sketch.capacity);
+    TEST_ASSERT_TRUE(fabs(fscl_sketch_quantile(&sketch, 0.5) - 1000000.0) < 300000.0);
+    fscl_sketch_erase(&sketch);
+}
+
+XTEST_CASE(test_fscl_sketch_merge) {
+    cquantile_sketch total, shard;
+    fscl_sketch_create(&total, 200);
+    for (size_t s = 0; s < 4; ++s) {
+        fscl_sketch_create(&shard, 200);
+        for (size_t i = 0; i < 25000; ++i) {
+            fscl_sketch_update(&shard, (double)(s * 25000 + i));
+        }
+        fscl_sketch_merge(&total, &shard);
+        fscl_sketch_erase(&shard);
+    }
+
+    TEST_ASSERT_EQUAL_UINT(100000, total.count);
+    TEST_ASSERT_TRUE(fabs(fscl_sketch_quantile(&total, 0.5) - 50000.0) < 2000.0);
+    TEST_ASSERT_TRUE(fabs(fscl_sketch_quantile(&total, 0.9) - 90000.0) < 2000.0);
+    fscl_sketch_erase(&total);
+}
+
+XTEST_CASE(test_fscl_data_quantile_limit) {
+    // At the limit the copy is exact and interpolates between the two
+    // middle order statistics
+    cdataset myDataset;
+    fscl_data_create(&myDataset, FSCL_QUANTILE_EXACT_LIMIT);
+    for (size_t i = 0; i < myDataset.size; ++i) {
+        myDataset.data[i] = (double)((i * 7919) % myDataset.size);
+    }
+    TEST_ASSERT_DOUBLE_EQUAL((double)(FSCL_QUANTILE_EXACT_LIMIT - 1) / 2.0, fscl_data_median(&myDataset));
+    fscl_data_erase(&myDataset);
+}
+
+XTEST_CASE(test_fscl_data_quantile_large) {
+    // Above the limit the answer comes from the sketches: a retained
+    // value, so a whole number where the exact median is 1499999.5
+    cdataset myDataset;
+    fscl_data_create(&myDataset, 3000000);
+    for (size_t i = 0; i < myDataset.size; ++i) {
+        myDataset.data[i] = (double)((i * 7919) % myDataset.size);
+    }
+
+    double q[] = {0.0, 0.5, 0.9, 1.0};
+    double serial[4], parallel[4];
+    TEST_ASSERT_EQUAL(0, fscl_data_quantiles(&myDataset, q, 4, serial));
+    fscl_parallel_set_threads(4);
+    TEST_ASSERT_EQUAL(0, fscl_data_quantiles(&myDataset, q, 4, parallel));
+    fscl_parallel_set_threads(1);
+
+    TEST_ASSERT_DOUBLE_EQUAL(0.0, serial[0]);
+    TEST_ASSERT_DOUBLE_EQUAL(2999999.0, serial[3]);
+    TEST_ASSERT_TRUE(serial[1] == floor(serial[1]));
+    TEST_ASSERT_TRUE(fabs(serial[1] - 1500000.0) < 30000.0);
+    TEST_ASSERT_TRUE(fabs(serial[2] - 2700000.0) < 30000.0);
+    for (size_t p = 0; p < 4; ++p) {
+        TEST_ASSERT_TRUE(serial[p] == parallel[p]);
+    }
+    TEST_ASSERT_TRUE(serial[1] == fscl_data_quantile(&myDataset, 0.5));
+
+    fscl_data_erase(&myDataset);
+}
+
+//
+// XUNIT-GROUP: a group of test cases from the current test file
+//
+XTEST_DEFINE_POOL(test_quantile_group) {
+    XTEST_RUN_UNIT(test_fscl_data_quantile_exact);
+    XTEST_RUN_UNIT(test_fscl_data_quantiles);
+    XTEST_RUN_UNIT(test_fscl_sketch_rank_error);
+    XTEST_RUN_UNIT(test_fscl_sketch_deep);
+    XTEST_RUN_UNIT(test_fscl_sketch_merge);
+    XTEST_RUN_UNIT(test_fscl_data_quantile_limit);
+    XTEST_RUN_UNIT(test_fscl_data_quantile_large);
+} // end of fixture
@@ -0,0 +1,91 @@
+/*
+==============================================================================
+Author: Michael Gene Brockus (Dreamer)
+Email: michaelbrockus@gmail.com
+Organization: Fossil Logic
+Description: 
+    This file is part of the Fossil Logic project, where innovation meets
+    excellence in software development. Michael Gene Brockus, also known as
+    "Dreamer," is a dedicated contributor to this project. For any inquiries,
+    feel free to contact Michael at michaelbrockus@gmail.com.
+==============================================================================
+*/
+#include <fossil/xtest.h>   // basic test tools
+#include <fossil/xassert.h> // extra asserts
+
+#include <fossil/xscience/random.h> // library under test
+#include <fossil/xscience/parallel.h>
+#include <string.h>
+
+//
+// XUNIT-CASES: list of test cases testing project features
+//
+
+XTEST_CASE(test_fscl_random_streams) {
+    crandom a, b;
+    fscl_random_seed(&a, 42);
+    fscl_random_seed(&b, 42);
+    TEST_ASSERT_TRUE(fscl_random_next(&a) == fscl_random_next(&b));
+
+    // A jumped stream no longer matches the original
+    fscl_random_jump(&b);
+    TEST_ASSERT_TRUE(fscl_random_next(&a) != fscl_random_next(&b));
+
+    // The bulk fill draws its first lane from the stream itself
+    double values[8];
+    fscl_random_seed(&a, 7);
+    fscl_random_seed(&b, 7);
+    fscl_random_fill(&a, values, 8, FSCL_RANDOM_UNIFORM, 0.0, 1.0);
+    TEST_ASSERT_DOUBLE_EQUAL(fscl_random_uniform(&b), values[0]);
+    TEST_ASSERT_DOUBLE_EQUAL(fscl_random_uniform(&b), values[4]);
+    TEST_ASSERT_TRUE(fscl_random_next(&a) == fscl_random_next(&b));
+}
+
+XTEST_CASE(test_fscl_random_distributions) {
+    cdataset myDataset;
+    cdataset_stats stats;
+    fscl_data_create(&myDataset, 200001);
+
+    fscl_data_fill_random_ex(&myDataset, 1, FSCL_RANDOM_UNIFORM, -2.0, 2.0);
+    fscl_data_stats(&myDataset, &stats);
+    TEST_ASSERT_TRUE(stats.min >= -2.0 && stats.max < 2.0);
+    TEST_ASSERT_TRUE(fabs(stats.mean) < 0.02);
+
+    fscl_data_fill_random_ex(&myDataset, 2, FSCL_RANDOM_NORMAL, 5.0, 3.0);
+    fscl_data_stats(&myDataset, &stats);
+    TEST_ASSERT_TRUE(fabs(stats.mean - 5.0) < 0.05);
+    TEST_ASSERT_TRUE(fabs(sqrt(stats.variance) - 3.0) < 0.05);
+
+    fscl_data_fill_random_ex(&myDataset, 3, FSCL_RANDOM_EXPONENTIAL, 4.0, 0.0);
+    fscl_data_stats(&myDataset, &stats);
+    TEST_ASSERT_TRUE(stats.min >= 0.0);
+    TEST_ASSERT_TRUE(fabs(stats.mean - 0.25) < 0.005);
+
+    fscl_data_erase(&myDataset);
+}
+
+XTEST_CASE(test_fscl_data_fill_random_parallel) {
+    cdataset serial, parallel;
+    fscl_data_create(&serial, 300000);
+    fscl_data_create(&parallel, 300000);
+
+    fscl_data_fill_random_ex(&serial, 99, FSCL_RANDOM_NORMAL, 0.0, 1.0);
+    fscl_parallel_set_threads(4);
+    fscl_data_fill_random_ex(&parallel, 99, FSCL_RANDOM_NORMAL, 0.0, 1.0);
+    fscl_parallel_set_threads(1);
+
+    // The values depend on the seed only, not on the thread count
+    TEST_ASSERT_TRUE(memcmp(serial.data, parallel.data, serial.size * sizeof(double)) == 0);
+
+    fscl_data_erase(&serial);
+    fscl_data_erase(&parallel);
+}
+
+//
+// XUNIT-GROUP: a group of test cases from the current test file
+//
+XTEST_DEFINE_POOL(test_random_group) {
+    XTEST_RUN_UNIT(test_fscl_random_streams);
+    XTEST_RUN_UNIT(test_fscl_random_distributions);
+    XTEST_RUN_UNIT(test_fscl_data_fill_random_parallel);
+} // end of fixture
@@ -0,0 +1,115 @@
+/*
+==============================================================================
+Author: Michael Gene Brockus (Dreamer)
+Email: michaelbrockus@gmail.com
+Organization: Fossil Logic
+Description: 
+    This file is part of the Fossil Logic project, where innovation meets
+    excellence in software development. Michael Gene Brockus, also known as
+    "Dreamer," is a dedicated contributor to this project. For any inquiries,
+    feel free to contact Michael at michaelbrockus@gmail.com.
+==============================================================================
+*/
+#include <fossil/xtest.h>   // basic test tools
+#include <fossil/xassert.h> // extra asserts
+
+#include <fossil/xscience/rolling.h> // library under test
+#include <fossil/xscience/random.h>
+#include <fossil/xscience/parallel.h>
+#include <string.h>
+
+//
+// XUNIT-CASES: list of test cases testing project features
+//
+
+XTEST_CASE(test_fscl_rolling_push) {
+    crolling rolling;
+    cdataset_stats stats;
+    TEST_ASSERT_EQUAL(-1, fscl_rolling_create(&rolling, 0));
+    TEST_ASSERT_EQUAL(0, fscl_rolling_create(&rolling, 3));
+
+    fscl_rolling_push(&rolling, 4.0);
+    fscl_rolling_push(&rolling, 1.0);
+    fscl_rolling_stats(&rolling, &stats);
+    TEST_ASSERT_EQUAL(2, stats.count);
+    TEST_ASSERT_DOUBLE_EQUAL(2.5, stats.mean);
+    TEST_ASSERT_DOUBLE_EQUAL(1.0, stats.min);
+
+    // Window now holds 1, 5, NaN
+    fscl_rolling_push(&rolling, 5.0);
+    fscl_rolling_push(&rolling, NAN);
+    fscl_rolling_stats(&rolling, &stats);
+    TEST_ASSERT_EQUAL(2, stats.count);
+    TEST_ASSERT_EQUAL(1, stats.nan_count);
+    TEST_ASSERT_DOUBLE_EQUAL(6.0, stats.sum);
+    TEST_ASSERT_DOUBLE_EQUAL(4.0, stats.variance);
+    TEST_ASSERT_DOUBLE_EQUAL(1.0, stats.min);
+    TEST_ASSERT_DOUBLE_EQUAL(5.0, stats.max);
+
+    // Window now holds NaN, 2, 0
+    fscl_rolling_push(&rolling, 2.0);
+    fscl_rolling_push(&rolling, 0.0);
+    fscl_rolling_stats(&rolling, &stats);
+    TEST_ASSERT_DOUBLE_EQUAL(0.0, stats.min);
+    TEST_ASSERT_DOUBLE_EQUAL(2.0, stats.max);
+    TEST_ASSERT_DOUBLE_EQUAL(1.0, stats.mean);
+
+    fscl_rolling_erase(&rolling);
+}
+
+XTEST_CASE(test_fscl_data_rolling) {
+    cdataset myDataset, result;
+    const size_t window = 37;
+    fscl_data_create(&myDataset, 300000);
+    fscl_data_fill_random_ex(&myDataset, 5, FSCL_RANDOM_NORMAL, 1000.0, 2.0);
+
+    // Compare against a direct computation of a few windows
+    TEST_ASSERT_EQUAL(0, fscl_data_rolling(&myDataset, window, FSCL_ROLLING_VARIANCE, &result));
+    const size_t checks[] = {0, 10, 36, 65535, 65536, 65537, 299999};
+    for (size_t c = 0; c < sizeof(checks) / sizeof(checks[0]); ++c) {
+        size_t i = checks[c];
+        size_t first = i + 1 >= window ? i + 1 - window : 0;
+        cdataset view = {myDataset.data + first, i + 1 - first, NULL};
+        cdataset_stats stats;
+        fscl_data_stats(&view, &stats);
+        TEST_ASSERT_TRUE(fabs(result.data[i] - stats.variance) < 1e-6);
+    }
+    fscl_data_erase(&result);
+
+    TEST_ASSERT_EQUAL(0, fscl_data_rolling(&myDataset, window, FSCL_ROLLING_MAX, &result));
+    double max = myDataset.data[200000 - window + 1];
+    for (size_t i = 200000 - window + 1; i <= 200000; ++i) {
+        max = myDataset.data[i] > max ? myDataset.data[i] : max;
+    }
+    TEST_ASSERT_DOUBLE_EQUAL(max, result.data[200000]);
+    fscl_data_erase(&result);
+
+    fscl_data_erase(&myDataset);
+}
+
+XTEST_CASE(test_fscl_data_rolling_parallel) {
+    cdataset myDataset, serial, parallel;
+    fscl_data_create(&myDataset, 250000);
+    fscl_data_fill_random_ex(&myDataset, 9, FSCL_RANDOM_UNIFORM, -1.0, 1.0);
+
+    fscl_data_rolling(&myDataset, 100, FSCL_ROLLING_MEAN, &serial);
+    fscl_parallel_set_threads(4);
+    fscl_data_rolling(&myDataset, 100, FSCL_ROLLING_MEAN, &parallel);
+    fscl_parallel_set_threads(1);
+
+    // Chunks are fixed, so the result does not depend on the thread count
+    TEST_ASSERT_TRUE(memcmp(serial.data, parallel.data, serial.size * sizeof(double)) == 0);
+
+    fscl_data_erase(&serial);
+    fscl_data_erase(&parallel);
+    fscl_data_erase(&myDataset);
+}
+
+//
+// XUNIT-GROUP: a group of test cases from the current test file
+//
+XTEST_DEFINE_POOL(test_rolling_group) {
+    XTEST_RUN_UNIT(test_fscl_rolling_push);
+    XTEST_RUN_UNIT(test_fscl_data_rolling);
+    XTEST_RUN_UNIT(test_fscl_data_rolling_parallel);
+} // end of fixture
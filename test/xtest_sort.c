@@ -0,0 +1,100 @@
+/*
+==============================================================================
+Author: Michael Gene Brockus (Dreamer)
+Email: michaelbrockus@gmail.com
+Organization: Fossil Logic
+Description: 
+    This file is part of the Fossil Logic project, where innovation meets
+    excellence in software development. Michael Gene Brockus, also known as
+    "Dreamer," is a dedicated contributor to this project. For any inquiries,
+    feel free to contact Michael at michaelbrockus@gmail.com.
+==============================================================================
+*/
+#include <fossil/xtest.h>   // basic test tools
+#include <fossil/xassert.h> // extra asserts
+
+#include <fossil/xscience/sort.h> // library under test
+#include <fossil/xscience/random.h>
+#include <fossil/xscience/parallel.h>
+#include <string.h>
+
+//
+// XUNIT-CASES: list of test cases testing project features
+//
+
+XTEST_CASE(test_fscl_data_sort) {
+    double values[] = {3.5, NAN, -1.0, INFINITY, 0.0, -INFINITY, -0.0, 2.0, NAN, -1e300};
+    cdataset myDataset = {values, 10, NULL};
+
+    TEST_ASSERT_EQUAL(0, fscl_data_sort(&myDataset, FSCL_SORT_NAN_FIRST));
+    TEST_ASSERT_TRUE(isnan(values[0]) && isnan(values[1]));
+    TEST_ASSERT_TRUE(isinf(values[2]) && values[2] < 0.0);
+    TEST_ASSERT_DOUBLE_EQUAL(-1e300, values[3]);
+    TEST_ASSERT_DOUBLE_EQUAL(-1.0, values[4]);
+    TEST_ASSERT_TRUE(signbit(values[5]) && values[5] == 0.0);
+    TEST_ASSERT_TRUE(!signbit(values[6]) && values[6] == 0.0);
+    TEST_ASSERT_DOUBLE_EQUAL(3.5, values[8]);
+    TEST_ASSERT_TRUE(isinf(values[9]) && values[9] > 0.0);
+
+    TEST_ASSERT_EQUAL(0, fscl_data_sort(&myDataset, FSCL_SORT_NAN_LAST));
+    TEST_ASSERT_TRUE(isinf(values[0]) && values[0] < 0.0);
+    TEST_ASSERT_TRUE(isnan(values[8]) && isnan(values[9]));
+}
+
+XTEST_CASE(test_fscl_data_sort_parallel) {
+    cdataset serial, parallel;
+    fscl_data_create(&serial, 500000);
+    fscl_data_create(&parallel, 500000);
+    fscl_data_fill_random_ex(&serial, 11, FSCL_RANDOM_NORMAL, 0.0, 1000.0);
+    memcpy(parallel.data, serial.data, serial.size * sizeof(double));
+
+    fscl_data_sort(&serial, FSCL_SORT_NAN_LAST);
+    fscl_parallel_set_threads(4);
+    fscl_data_sort(&parallel, FSCL_SORT_NAN_LAST);
+    fscl_parallel_set_threads(1);
+
+    int sorted = 1;
+    for (size_t i = 1; i < serial.size; ++i) {
+        sorted &= serial.data[i - 1] <= serial.data[i];
+    }
+    TEST_ASSERT_TRUE(sorted);
+    TEST_ASSERT_TRUE(memcmp(serial.data, parallel.data, serial.size * sizeof(double)) == 0);
+
+    fscl_data_erase(&serial);
+    fscl_data_erase(&parallel);
+}
+
+XTEST_CASE(test_fscl_data_argsort_and_rank) {
+    double values[] = {5.0, 1.0, NAN, 5.0, -2.0, 1.0};
+    cdataset myDataset = {values, 6, NULL};
+    size_t order[6];
+    cdataset ranks;
+
+    // Ties keep their original order
+    TEST_ASSERT_EQUAL(0, fscl_data_argsort(&myDataset, FSCL_SORT_NAN_LAST, order));
+    TEST_ASSERT_EQUAL(4, order[0]);
+    TEST_ASSERT_EQUAL(1, order[1]);
+    TEST_ASSERT_EQUAL(5, order[2]);
+    TEST_ASSERT_EQUAL(0, order[3]);
+    TEST_ASSERT_EQUAL(3, order[4]);
+    TEST_ASSERT_EQUAL(2, order[5]);
+    TEST_ASSERT_EQUAL(0, fscl_data_argsort(&myDataset, FSCL_SORT_NAN_FIRST, order));
+    TEST_ASSERT_EQUAL(2, order[0]);
+    TEST_ASSERT_EQUAL(4, order[1]);
+
+    TEST_ASSERT_EQUAL(0, fscl_data_rank(&myDataset, &ranks));
+    TEST_ASSERT_DOUBLE_EQUAL(4.5, ranks.data[0]);
+    TEST_ASSERT_DOUBLE_EQUAL(2.5, ranks.data[1]);
+    TEST_ASSERT_TRUE(isnan(ranks.data[2]));
+    TEST_ASSERT_DOUBLE_EQUAL(1.0, ranks.data[4]);
+    fscl_data_erase(&ranks);
+}
+
+//
+// XUNIT-GROUP: a group of test cases from the current test file
+//
+XTEST_DEFINE_POOL(test_sort_group) {
+    XTEST_RUN_UNIT(test_fscl_data_sort);
+    XTEST_RUN_UNIT(test_fscl_data_sort_parallel);
+    XTEST_RUN_UNIT(test_fscl_data_argsort_and_rank);
+} // end of fixture
@@ -0,0 +1,87 @@
+/*
+==============================================================================
+Author: Michael Gene Brockus (Dreamer)
+Email: michaelbrockus@gmail.com
+Organization: Fossil Logic
+Description: 
+    This file is part of the Fossil Logic project, where innovation meets
+    excellence in software development. Michael Gene Brockus, also known as
+    "Dreamer," is a dedicated contributor to this project. For any inquiries,
+    feel free to contact Michael at michaelbrockus@gmail.com.
+==============================================================================
+*/
+#include <fossil/xtest.h>   // basic test tools
+#include <fossil/xassert.h> // extra asserts
+
+#include <fossil/xscience/sparse.h> // library under test
+
+//
+// XUNIT-CASES: list of test cases testing project features
+//
+
+XTEST_CASE(test_fscl_data_one_hot_sparse) {
+    double categoryData[] = {7.0, 2.0, NAN, 7.0, 1000000.0};
+    cdataset categories = {categoryData, 5, NULL};
+    csparse matrix;
+    ccategorical column;
+
+    TEST_ASSERT_EQUAL(0, fscl_data_one_hot_sparse(&categories, &matrix, &column));
+    TEST_ASSERT_EQUAL(3, column.num_categories);
+    TEST_ASSERT_DOUBLE_EQUAL(2.0, column.dictionary[0]);
+    TEST_ASSERT_DOUBLE_EQUAL(1000000.0, column.dictionary[2]);
+    TEST_ASSERT_TRUE(column.codes[2] == FSCL_CATEGORY_MISSING);
+
+    // One entry per non-missing row, however large the category values
+    TEST_ASSERT_EQUAL(5, matrix.rows);
+    TEST_ASSERT_EQUAL(3, matrix.cols);
+    TEST_ASSERT_EQUAL(4, matrix.nnz);
+    TEST_ASSERT_EQUAL(1, matrix.columns[matrix.row_start[0]]);
+    TEST_ASSERT_EQUAL(matrix.row_start[2], matrix.row_start[3]);
+    TEST_ASSERT_EQUAL(2, matrix.columns[matrix.row_start[4]]);
+    TEST_ASSERT_DOUBLE_EQUAL(4.0, fscl_sparse_sum(&matrix));
+
+    fscl_sparse_erase(&matrix);
+    fscl_categorical_erase(&column);
+}
+
+XTEST_CASE(test_fscl_sparse_coo_and_dot) {
+    // [[0, 2, 0], [1, 0, 3]] with a duplicate entry for (1, 2)
+    size_t rows[] = {1, 0, 1, 1};
+    size_t cols[] = {2, 1, 0, 2};
+    double values[] = {1.0, 2.0, 1.0, 2.0};
+    csparse matrix;
+    cdataset dense, result;
+
+    TEST_ASSERT_EQUAL(0, fscl_sparse_from_coo(&matrix, 2, 3, rows, cols, values, 4));
+    TEST_ASSERT_EQUAL(3, matrix.nnz);
+    TEST_ASSERT_EQUAL(0, fscl_sparse_to_dense(&matrix, &dense));
+    TEST_ASSERT_DOUBLE_EQUAL(2.0, dense.data[1]);
+    TEST_ASSERT_DOUBLE_EQUAL(1.0, dense.data[3]);
+    TEST_ASSERT_DOUBLE_EQUAL(3.0, dense.data[5]);
+
+    double vectorData[] = {1.0, 10.0, 100.0};
+    cdataset vector = {vectorData, 3, NULL};
+    fscl_sparse_scale(&matrix, 2.0);
+    TEST_ASSERT_EQUAL(0, fscl_sparse_dot_product(&matrix, &vector, &result));
+    TEST_ASSERT_DOUBLE_EQUAL(40.0, result.data[0]);
+    TEST_ASSERT_DOUBLE_EQUAL(602.0, result.data[1]);
+    fscl_data_erase(&result);
+    fscl_sparse_erase(&matrix);
+
+    // Round trip through the dense form
+    TEST_ASSERT_EQUAL(0, fscl_sparse_from_dense(&matrix, &dense, 3));
+    TEST_ASSERT_EQUAL(3, matrix.nnz);
+    TEST_ASSERT_DOUBLE_EQUAL(6.0, fscl_sparse_sum(&matrix));
+    fscl_sparse_erase(&matrix);
+    TEST_ASSERT_EQUAL(-1, fscl_sparse_from_coo(&matrix, 2, 3, cols, rows, values, 4));
+
+    fscl_data_erase(&dense);
+}
+
+//
+// XUNIT-GROUP: a group of test cases from the current test file
+//
+XTEST_DEFINE_POOL(test_sparse_group) {
+    XTEST_RUN_UNIT(test_fscl_data_one_hot_sparse);
+    XTEST_RUN_UNIT(test_fscl_sparse_coo_and_dot);
+} // end of fixture
@@ -0,0 +1,144 @@
+/*
+==============================================================================
+Author: Michael Gene Brockus (Dreamer)
+Email: michaelbrockus@gmail.com
+Organization: Fossil Logic
+Description: 
+    This file is part of the Fossil Logic project, where innovation meets
+    excellence in software development. Michael Gene Brockus, also known as
+    "Dreamer," is a dedicated contributor to this project. For any inquiries,
+    feel free to contact Michael at michaelbrockus@gmail.com.
+==============================================================================
+*/
+#include <fossil/xtest.h>   // basic test tools
+#include <fossil/xassert.h> // extra asserts
+
+#include <fossil/xscience/stream.h> // library under test
+
+#if defined(_WIN32)
+#include <windows.h>
+#else
+#include <pthread.h>
+#endif
+
+//
+// XUNIT-CASES: list of test cases testing project features
+//
+
+XTEST_CASE(test_fscl_stream_views) {
+    cstream stream;
+    cdataset views[2];
+    cdataset_stats stats;
+    double values[6] = {1.0, 2.0, 3.0, 4.0, 5.0, 6.0};
+    double out[4];
+
+    TEST_ASSERT_EQUAL(-1, fscl_stream_create(&stream, 0));
+    TEST_ASSERT_EQUAL(0, fscl_stream_create(&stream, 7));
+    TEST_ASSERT_EQUAL(8, stream.capacity);
+
+    TEST_ASSERT_EQUAL(6, fscl_stream_push(&stream, values, 6));
+    TEST_ASSERT_EQUAL(4, fscl_stream_pop(&stream, out, 4));
+    TEST_ASSERT_DOUBLE_EQUAL(4.0, out[3]);
+
+    // Six more samples wrap around; only the free space is taken
+    TEST_ASSERT_EQUAL(6, fscl_stream_push(&stream, values, 6));
+    TEST_ASSERT_EQUAL(0, fscl_stream_push(&stream, values, 1));
+    TEST_ASSERT_EQUAL(8, fscl_stream_size(&stream));
+
+    TEST_ASSERT_EQUAL(2, fscl_stream_views(&stream, views));
+    TEST_ASSERT_EQUAL(4, views[0].size);
+    TEST_ASSERT_EQUAL(4, views[1].size);
+    TEST_ASSERT_DOUBLE_EQUAL(5.0, views[0].data[0]);
+    TEST_ASSERT_DOUBLE_EQUAL(3.0, views[1].data[0]);
+
+    // Existing reductions run on the views in place
+    fscl_stream_stats(&stream, &stats);
+    TEST_ASSERT_EQUAL(8, stats.count);
+    TEST_ASSERT_DOUBLE_EQUAL(32.0, stats.sum);
+    TEST_ASSERT_DOUBLE_EQUAL(1.0, stats.min);
+    TEST_ASSERT_DOUBLE_EQUAL(6.0, fscl_data_max(&views[1]));
+
+    TEST_ASSERT_EQUAL(5, fscl_stream_consume(&stream, 5));
+    TEST_ASSERT_EQUAL(1, fscl_stream_views(&stream, views));
+    TEST_ASSERT_EQUAL(3, views[0].size);
+    TEST_ASSERT_EQUAL(3, fscl_stream_consume(&stream, 10));
+    TEST_ASSERT_EQUAL(0, fscl_stream_views(&stream, views));
+
+    fscl_stream_erase(&stream);
+}
+
+// Shared state of the concurrent test
+typedef struct {
+    cstream stream;
+    size_t total;
+    double sum;
+} stream_test_job;
+
+// Consumer of the concurrent test, on a thread of its own so it can never
+// share one with the producer
+#if defined(_WIN32)
+static DWORD WINAPI stream_test_consumer(LPVOID context) {
+#else
+static void *stream_test_consumer(void *context) {
+#endif
+    stream_test_job *job = (stream_test_job *)context;
+    cdataset views[2];
+
+    for (size_t received = 0; received < job->total;) {
+        fscl_stream_views(&job->stream, views);
+        for (size_t v = 0; v < 2; ++v) {
+            job->sum += fscl_data_sum(&views[v]);
+            received += fscl_stream_consume(&job->stream, views[v].size);
+        }
+    }
+    return 0;
+}
+
+XTEST_CASE(test_fscl_stream_concurrent) {
+    stream_test_job job;
+    job.total = 1000000;
+    job.sum = 0.0;
+    fscl_stream_create(&job.stream, 1024);
+
+#if defined(_WIN32)
+    HANDLE consumer = CreateThread(NULL, 0, stream_test_consumer, &job, 0, NULL);
+    int started = consumer != NULL;
+#else
+    pthread_t consumer;
+    int started = pthread_create(&consumer, NULL, stream_test_consumer, &job) == 0;
+#endif
+
+    // The producer keeps writing while the consumer reduces the live views
+    if (started) {
+        double batch[100];
+        for (size_t sent = 0; sent < job.total;) {
+            size_t count = job.total - sent < 100 ? job.total - sent : 100;
+            for (size_t i = 0; i < count; ++i) {
+                batch[i] = (double)(sent + i);
+            }
+            size_t done = 0;
+            while (done < count) {
+                done += fscl_stream_push(&job.stream, batch + done, count - done);
+            }
+            sent += count;
+        }
+#if defined(_WIN32)
+        WaitForSingleObject(consumer, INFINITE);
+        CloseHandle(consumer);
+#else
+        pthread_join(consumer, NULL);
+#endif
+        TEST_ASSERT_DOUBLE_EQUAL(499999500000.0, job.sum);
+        TEST_ASSERT_EQUAL(0, fscl_stream_size(&job.stream));
+    }
+
+    fscl_stream_erase(&job.stream);
+}
+
+//
+// XUNIT-GROUP: a group of test cases from the current test file
+//
+XTEST_DEFINE_POOL(test_stream_group) {
+    XTEST_RUN_UNIT(test_fscl_stream_views);
+    XTEST_RUN_UNIT(test_fscl_stream_concurrent);
+} // end of fixture
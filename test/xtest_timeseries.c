@@ -0,0 +1,95 @@
+/*
+==============================================================================
+Author: Michael Gene Brockus (Dreamer)
+Email: michaelbrockus@gmail.com
+Organization: Fossil Logic
+Description: 
+    This file is part of the Fossil Logic project, where innovation meets
+    excellence in software development. Michael Gene Brockus, also known as
+    "Dreamer," is a dedicated contributor to this project. For any inquiries,
+    feel free to contact Michael at michaelbrockus@gmail.com.
+==============================================================================
+*/
+#include <fossil/xtest.h>   // basic test tools
+#include <fossil/xassert.h> // extra asserts
+
+#include <fossil/xscience/timeseries.h> // library under test
+#include <string.h>
+
+//
+// XUNIT-CASES: list of test cases testing project features
+//
+
+static int count_block(const cdataset *block, size_t offset, void *context) {
+    size_t *visited = (size_t *)context;
+    *visited += block->size;
+    return offset >= FSCL_SERIES_BLOCK;  // stop after the second block
+}
+
+XTEST_CASE(test_fscl_series_roundtrip) {
+    cdataset myDataset;
+    fscl_data_create(&myDataset, 3000);
+    for (size_t i = 0; i < myDataset.size; ++i) {
+        myDataset.data[i] = 20.0 + 0.25 * (double)(i % 40);
+    }
+    myDataset.data[17] = NAN;
+    myDataset.data[2500] = -1.0e300;
+
+    ctimeseries series;
+    TEST_ASSERT_EQUAL_INT(0, fscl_series_compress(&series, &myDataset));
+    TEST_ASSERT_EQUAL_UINT(3, series.num_blocks);
+    TEST_ASSERT_TRUE(fscl_series_bytes(&series) * 4 < myDataset.size * sizeof(double));
+
+    cdataset restored;
+    TEST_ASSERT_EQUAL_INT(0, fscl_series_decompress(&series, &restored));
+    TEST_ASSERT_EQUAL_UINT(myDataset.size, restored.size);
+    TEST_ASSERT_TRUE(memcmp(myDataset.data, restored.data, myDataset.size * sizeof(double)) == 0);
+
+    fscl_data_erase(&restored);
+    fscl_series_erase(&series);
+    fscl_data_erase(&myDataset);
+}
+
+XTEST_CASE(test_fscl_series_block_queries) {
+    cdataset myDataset;
+    fscl_data_create(&myDataset, 2 * FSCL_SERIES_BLOCK + 100);
+    for (size_t i = 0; i < myDataset.size; ++i) {
+        myDataset.data[i] = (double)i;
+    }
+    myDataset.data[5] = NAN;
+
+    ctimeseries series;
+    fscl_series_compress(&series, &myDataset);
+
+    cdataset_stats stats;
+    fscl_series_stats(&series, &stats);
+    TEST_ASSERT_EQUAL_UINT(myDataset.size - 1, stats.count);
+    TEST_ASSERT_EQUAL_UINT(1, stats.nan_count);
+    TEST_ASSERT_DOUBLE_EQUAL(0.0, stats.min);
+    TEST_ASSERT_DOUBLE_EQUAL((double)(myDataset.size - 1), stats.max);
+    double total = (double)myDataset.size * (double)(myDataset.size - 1) / 2.0 - 5.0;
+    TEST_ASSERT_DOUBLE_EQUAL(total, stats.sum);
+
+    // Range spanning a partial, a whole and a partial block
+    double expected = 0.0;
+    for (size_t i = 1000; i < 2100; ++i) {
+        expected += (double)i;
+    }
+    TEST_ASSERT_DOUBLE_EQUAL(expected, fscl_series_sum_range(&series, 1000, 2100));
+    TEST_ASSERT_DOUBLE_EQUAL(10.0, fscl_series_sum_range(&series, 4, 7));
+
+    size_t visited = 0;
+    TEST_ASSERT_EQUAL_INT(1, fscl_series_foreach(&series, count_block, &visited));
+    TEST_ASSERT_EQUAL_UINT(2 * FSCL_SERIES_BLOCK, visited);
+
+    fscl_series_erase(&series);
+    fscl_data_erase(&myDataset);
+}
+
+//
+// XUNIT-GROUP: a group of test cases from the current test file
+//
+XTEST_DEFINE_POOL(test_timeseries_group) {
+    XTEST_RUN_UNIT(test_fscl_series_roundtrip);
+    XTEST_RUN_UNIT(test_fscl_series_block_queries);
+} // end of fixture
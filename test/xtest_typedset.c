@@ -0,0 +1,141 @@
+/*
+==============================================================================
+Author: Michael Gene Brockus (Dreamer)
+Email: michaelbrockus@gmail.com
+Organization: Fossil Logic
+Description: 
+    This file is part of the Fossil Logic project, where innovation meets
+    excellence in software development. Michael Gene Brockus, also known as
+    "Dreamer," is a dedicated contributor to this project. For any inquiries,
+    feel free to contact Michael at michaelbrockus@gmail.com.
+==============================================================================
+*/
+#include <fossil/xtest.h>   // basic test tools
+#include <fossil/xassert.h> // extra asserts
+
+#include <fossil/xscience/typedset.h> // library under test
+#include <fossil/xscience/parallel.h>
+
+//
+// XUNIT-CASES: list of test cases testing project features
+//
+
+XTEST_CASE(test_fscl_data_typed_float) {
+    cdataset_f32 readings;
+    fscl_data_create(&readings, 6);
+    float values[] = {2.0f, 4.0f, NAN, 4.0f, 6.0f, 8.0f};
+    for (size_t i = 0; i < readings.size; ++i) {
+        readings.data[i] = values[i];
+    }
+
+    TEST_ASSERT_DOUBLE_EQUAL(2.0, fscl_data_min(&readings));
+    TEST_ASSERT_DOUBLE_EQUAL(8.0, fscl_data_max(&readings));
+
+    cdataset_stats stats;
+    fscl_data_stats(&readings, &stats);
+    TEST_ASSERT_EQUAL_UINT(5, stats.count);
+    TEST_ASSERT_EQUAL_UINT(1, stats.nan_count);
+    TEST_ASSERT_DOUBLE_EQUAL(4.8, stats.mean);
+    TEST_ASSERT_DOUBLE_EQUAL(24.0, stats.sum);
+
+    fscl_data_scale(&readings, 0.5);
+    TEST_ASSERT_DOUBLE_EQUAL(4.0, readings.data[5]);
+
+    fscl_data_erase(&readings);
+    TEST_ASSERT_TRUE(readings.data == NULL);
+}
+
+XTEST_CASE(test_fscl_data_typed_nan_policy) {
+    double wide_values[] = {1.0, NAN, 3.0};
+    cdataset wide = {wide_values, 3, NULL};
+    cdataset_f32 narrow;
+    fscl_data_create(&narrow, 3);
+    narrow.data[0] = 1.0f;
+    narrow.data[1] = NAN;
+    narrow.data[2] = 3.0f;
+
+    // The same front-end gives the same answer for either element type
+    TEST_ASSERT_TRUE(isnan(fscl_data_sum(&wide)));
+    TEST_ASSERT_TRUE(isnan(fscl_data_sum(&narrow)));
+    TEST_ASSERT_TRUE(isnan(fscl_data_mean(&wide)));
+    TEST_ASSERT_TRUE(isnan(fscl_data_mean(&narrow)));
+    TEST_ASSERT_TRUE(isnan(fscl_data_std_dev(&wide)));
+    TEST_ASSERT_TRUE(isnan(fscl_data_std_dev(&narrow)));
+    TEST_ASSERT_DOUBLE_EQUAL(fscl_data_max(&wide), fscl_data_max(&narrow));
+
+    wide_values[1] = 2.0;
+    narrow.data[1] = 2.0f;
+    TEST_ASSERT_DOUBLE_EQUAL(fscl_data_mean(&wide), fscl_data_mean(&narrow));
+    TEST_ASSERT_DOUBLE_EQUAL(fscl_data_std_dev(&wide), fscl_data_std_dev(&narrow));
+
+    fscl_data_erase(&narrow);
+}
+
+XTEST_CASE(test_fscl_data_typed_int16) {
+    cdataset_i16 samples;
+    fscl_data_create(&samples, 4);
+    samples.data[0] = -3;
+    samples.data[1] = 7;
+    samples.data[2] = 30000;
+    samples.data[3] = -30000;
+
+    TEST_ASSERT_DOUBLE_EQUAL(1.0, fscl_data_mean(&samples));
+    TEST_ASSERT_DOUBLE_EQUAL(-30000.0, fscl_data_min(&samples));
+
+    // Scaling rounds and saturates at the limits of int16_t
+    fscl_data_scale(&samples, 1.5);
+    TEST_ASSERT_EQUAL_INT(-4, samples.data[0]);
+    TEST_ASSERT_EQUAL_INT(10, samples.data[1]);  // 10.5 rounds to even
+    TEST_ASSERT_EQUAL_INT(INT16_MAX, samples.data[2]);
+    TEST_ASSERT_EQUAL_INT(INT16_MIN, samples.data[3]);
+
+    cdataset wide;
+    TEST_ASSERT_EQUAL_INT(0, fscl_data_to_double_i16(&samples, &wide));
+    TEST_ASSERT_DOUBLE_EQUAL(10.0, wide.data[1]);
+    TEST_ASSERT_DOUBLE_EQUAL(fscl_data_mean(&samples), fscl_data_mean(&wide));
+
+    fscl_data_erase(&wide);
+    fscl_data_erase(&samples);
+}
+
+XTEST_CASE(test_fscl_data_typed_int32_chunks) {
+    cdataset_i32 counts;
+    fscl_data_create(&counts, 100003);
+    for (size_t i = 0; i < counts.size; ++i) {
+        counts.data[i] = (int32_t)(i % 1000) - 500;
+    }
+
+    int64_t expected = 0;
+    for (size_t i = 0; i < counts.size; ++i) {
+        expected += counts.data[i];
+    }
+
+    cdataset_stats serial, parallel;
+    fscl_data_stats(&counts, &serial);
+    double serial_sum = fscl_data_sum(&counts);
+    fscl_parallel_set_threads(4);
+    fscl_data_stats(&counts, &parallel);
+    double parallel_sum = fscl_data_sum(&counts);
+    fscl_parallel_set_threads(1);
+
+    TEST_ASSERT_DOUBLE_EQUAL((double)expected, serial_sum);
+    TEST_ASSERT_TRUE(serial_sum == parallel_sum);
+
+    TEST_ASSERT_TRUE(serial.mean == parallel.mean);
+    TEST_ASSERT_TRUE(serial.variance == parallel.variance);
+    TEST_ASSERT_DOUBLE_EQUAL(-500.0, serial.min);
+    TEST_ASSERT_DOUBLE_EQUAL(499.0, serial.max);
+    TEST_ASSERT_EQUAL_UINT(100003, serial.count);
+
+    fscl_data_erase(&counts);
+}
+
+//
+// XUNIT-GROUP: a group of test cases from the current test file
+//
+XTEST_DEFINE_POOL(test_typedset_group) {
+    XTEST_RUN_UNIT(test_fscl_data_typed_float);
+    XTEST_RUN_UNIT(test_fscl_data_typed_nan_policy);
+    XTEST_RUN_UNIT(test_fscl_data_typed_int16);
+    XTEST_RUN_UNIT(test_fscl_data_typed_int32_chunks);
+} // end of fixture
@@ -24,6 +24,21 @@ XTEST_EXTERN_POOL(test_robotics_group);
 XTEST_EXTERN_POOL(test_arospace_group);
 XTEST_EXTERN_POOL(test_decision_group);
 XTEST_EXTERN_POOL(test_dataset_group);
+XTEST_EXTERN_POOL(test_parallel_group);
+XTEST_EXTERN_POOL(test_dataio_group);
+XTEST_EXTERN_POOL(test_dataframe_group);
+XTEST_EXTERN_POOL(test_pipeline_group);
+XTEST_EXTERN_POOL(test_accumulator_group);
+XTEST_EXTERN_POOL(test_quantile_group);
+XTEST_EXTERN_POOL(test_typedset_group);
+XTEST_EXTERN_POOL(test_timeseries_group);
+XTEST_EXTERN_POOL(test_random_group);
+XTEST_EXTERN_POOL(test_rolling_group);
+XTEST_EXTERN_POOL(test_stream_group);
+XTEST_EXTERN_POOL(test_groupby_group);
+XTEST_EXTERN_POOL(test_sparse_group);
+XTEST_EXTERN_POOL(test_matrix_group);
+XTEST_EXTERN_POOL(test_sort_group);
 
 //
 // XUNIT-TEST RUNNER
@@ -40,6 +55,21 @@ int main(int argc, char **argv) {
     XTEST_IMPORT_POOL(test_arospace_group);
     XTEST_IMPORT_POOL(test_decision_group);
     XTEST_IMPORT_POOL(test_dataset_group);
+    XTEST_IMPORT_POOL(test_parallel_group);
+    XTEST_IMPORT_POOL(test_dataio_group);
+    XTEST_IMPORT_POOL(test_dataframe_group);
+    XTEST_IMPORT_POOL(test_pipeline_group);
+    XTEST_IMPORT_POOL(test_accumulator_group);
+    XTEST_IMPORT_POOL(test_quantile_group);
+    XTEST_IMPORT_POOL(test_typedset_group);
+    XTEST_IMPORT_POOL(test_timeseries_group);
+    XTEST_IMPORT_POOL(test_random_group);
+    XTEST_IMPORT_POOL(test_rolling_group);
+    XTEST_IMPORT_POOL(test_stream_group);
+    XTEST_IMPORT_POOL(test_groupby_group);
+    XTEST_IMPORT_POOL(test_sparse_group);
+    XTEST_IMPORT_POOL(test_matrix_group);
+    XTEST_IMPORT_POOL(test_sort_group);
 
     return XTEST_ERASE();
 } // end of func